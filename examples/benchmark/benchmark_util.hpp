@@ -0,0 +1,60 @@
+#pragma once
+
+/**
+ * @file benchmark_util.hpp
+ * @brief 性能测试程序共用的统计工具
+ */
+
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ * @brief 本进程已消耗的CPU时间（用户态+内核态，微秒）
+ */
+inline double processCpuMicroseconds() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1e6 + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+/**
+ * @brief 延迟样本统计
+ */
+class LatencyStats {
+public:
+    void add(std::chrono::nanoseconds sample) { samples_.push_back(sample.count() / 1000.0); }
+
+    std::size_t count() const { return samples_.size(); }
+
+    /**
+     * @brief 计算百分位数（微秒）
+     * @param p 百分位（0~100）
+     */
+    double percentile(double p) {
+        if (samples_.empty()) {
+            return 0.0;
+        }
+        std::sort(samples_.begin(), samples_.end());
+        std::size_t index = static_cast<std::size_t>(p / 100.0 * (samples_.size() - 1) + 0.5);
+        return samples_[std::min(index, samples_.size() - 1)];
+    }
+
+    /**
+     * @brief 打印一行统计结果
+     * @param name 测试项名称
+     */
+    void print(const char* name) {
+        std::printf("%-24s 样本=%-6zu p50=%9.1fus  p99=%9.1fus  max=%9.1fus\n",
+                    name, count(), percentile(50), percentile(99), percentile(100));
+    }
+
+private:
+    std::vector<double> samples_;  // 微秒
+};
+
+} // namespace benchmark
@@ -0,0 +1,93 @@
+/**
+ * @file busy_poll_benchmark.cpp
+ * @brief IO线程忙轮询与阻塞等待的往返时延对比
+ *
+ * 模拟遥控：主线程按固定周期同步发送 request2_SpeedControl（SDK限制速度指令不超过5Hz），测量其往返时延分布。
+ * 两次命令之间IO线程空闲，阻塞等待模式下IO线程在epoll中休眠，收到响应时需要被内核唤醒；
+ * 忙轮询模式下IO线程在自旋时长内持续轮询socket。同时输出进程的CPU占用。
+ * IO线程、调用线程和模拟服务端需要各自有空闲的CPU核，单核机器上忙轮询只会让出CPU，看不到收益。
+ *
+ * 模拟服务端运行在fork出的子进程中。
+ *
+ * 用法: busy_poll_benchmark [命令次数] [命令周期us] [自旋时长us]
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+void runCase(const std::string& name, TransportBackend backend, bool busyPoll, std::chrono::microseconds spin,
+             uint16_t port, int count, std::chrono::microseconds period) {
+    SdkOptions options;
+    options.transport = backend;
+    options.busyPoll.enabled = busyPoll;
+    options.busyPoll.spinDuration = spin;
+    RobotServerSdk sdk(options);
+    if (!sdk.connect("127.0.0.1", port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    benchmark::LatencyStats stats;
+    double cpuStart = benchmark::processCpuMicroseconds();
+    auto wallStart = std::chrono::steady_clock::now();
+    auto next = wallStart;
+    for (int i = 0; i < count; ++i) {
+        next += period;
+        auto start = std::chrono::steady_clock::now();
+        MotionControlResult result = sdk.request2_SpeedControl(SpeedCommand::FORWARD, 0.5f);
+        if (result.errorCode == ErrorCode_MotionControl::SUCCESS) {
+            stats.add(std::chrono::steady_clock::now() - start);
+        }
+        std::this_thread::sleep_until(next);
+    }
+    double wall = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - wallStart).count();
+    double cpu = benchmark::processCpuMicroseconds() - cpuStart;
+
+    stats.print(name.c_str());
+    std::printf("%-24s CPU占用 %.0f%%\n", name.c_str(), cpu / wall * 100);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 50;
+    std::chrono::microseconds period(argc > 2 ? std::atoi(argv[2]) : 201000);
+    std::chrono::microseconds spin(argc > 3 ? std::atoi(argv[3]) : 1000);
+
+    if (std::thread::hardware_concurrency() < 2) {
+        std::cout << "警告: 只有一个CPU核，忙轮询的IO线程与模拟服务端共用同一个核，结果不代表专用核上的时延" << std::endl;
+    }
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+
+    std::cout << "request2_SpeedControl 往返时延，命令周期 " << period.count() << "us，自旋时长 " << spin.count()
+              << "us（模拟服务端端口 " << port << "）" << std::endl;
+    const std::pair<const char*, TransportBackend> backends[] = {
+        {"ASIO", TransportBackend::ASIO},
+        {"EPOLL", TransportBackend::EPOLL},
+        {"IO_URING", TransportBackend::IO_URING},
+    };
+    for (const auto& backend : backends) {
+        std::string name = backend.first;
+        runCase(name + " 阻塞等待", backend.second, false, spin, port, count, period);
+        runCase(name + " 忙轮询", backend.second, true, spin, port, count, period);
+    }
+
+    benchmark::stopMockServerProcess(child);
+    return 0;
+}
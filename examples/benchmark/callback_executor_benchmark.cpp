@@ -0,0 +1,171 @@
+/**
+ * @file callback_executor_benchmark.cpp
+ * @brief 慢回调对接收处理的影响：回调在IO线程中直接调用 / 专用回调线程 / 用户线程池
+ *
+ * 一个线程持续下发导航任务，导航结果回调中模拟耗时的用户处理（休眠）；
+ * 主线程同时串行请求 request1002_RunTimeState，测量其往返时延。
+ * 回调在IO线程中直接调用时，1002的应答排在慢回调之后才能被处理。
+ * 最后输出SDK统计的回调排队时延和执行时长。
+ *
+ * 模拟服务端运行在fork出的子进程中。
+ *
+ * 用法: callback_executor_benchmark [1002请求数] [回调耗时us]
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+// 同时未完成的导航任务上限
+constexpr int MAX_NAV_TASKS_IN_FLIGHT = 8;
+
+/**
+ * @brief 演示用的简单线程池，代表调用方自己的执行器
+ */
+class SimpleThreadPool {
+public:
+    explicit SimpleThreadPool(int threads) {
+        for (int i = 0; i < threads; ++i) {
+            workers_.emplace_back([this]() {
+                while (true) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        ready_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+                        if (tasks_.empty()) {
+                            return;
+                        }
+                        task = std::move(tasks_.front());
+                        tasks_.pop_front();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+
+    ~SimpleThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        ready_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        ready_.notify_one();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::function<void()>> tasks_;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+
+void runCase(const char* name, const CallbackOptions& callbacks, uint16_t port, int count, int callbackMicros) {
+    SdkOptions options;
+    options.callbacks = callbacks;
+    RobotServerSdk sdk(options);
+    if (!sdk.connect("127.0.0.1", port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> inFlight{0};
+    std::thread navigation([&]() {
+        std::vector<NavigationPoint> points(4);
+        while (!stop) {
+            if (inFlight >= MAX_NAV_TASKS_IN_FLIGHT) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                continue;
+            }
+            ++inFlight;
+            sdk.request1003_StartNavTask(points, [&inFlight, callbackMicros](const NavigationResult&) {
+                std::this_thread::sleep_for(std::chrono::microseconds(callbackMicros));
+                --inFlight;
+            });
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    benchmark::LatencyStats stats;
+    for (int i = 0; i < count; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        if (sdk.request1002_RunTimeState().errorCode == ErrorCode_RealTimeStatus::SUCCESS) {
+            stats.add(std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    stop = true;
+    navigation.join();
+    while (inFlight > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    stats.print(name);
+    CallbackStatistics callbackStats = sdk.getCallbackStatistics();
+    std::printf("%-24s 回调%llu次 排队时延 平均%lluus 最大%lluus  执行时长 平均%lluus 最大%lluus\n", name,
+                static_cast<unsigned long long>(callbackStats.callbacksCompleted),
+                static_cast<unsigned long long>(callbackStats.avgQueueDelayMicros),
+                static_cast<unsigned long long>(callbackStats.maxQueueDelayMicros),
+                static_cast<unsigned long long>(callbackStats.avgDurationMicros),
+                static_cast<unsigned long long>(callbackStats.maxDurationMicros));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 2000;
+    int callbackMicros = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+
+    std::cout << "导航结果回调耗时 " << callbackMicros << "us 时 request1002 的往返时延（模拟服务端端口 " << port << "）"
+              << std::endl;
+
+    CallbackOptions inlineCallbacks;
+    runCase("INLINE", inlineCallbacks, port, count, callbackMicros);
+
+    CallbackOptions dedicated;
+    dedicated.execution = CallbackExecution::DEDICATED_THREAD;
+    runCase("DEDICATED_THREAD", dedicated, port, count, callbackMicros);
+
+    SimpleThreadPool pool(4);
+    CallbackOptions executor;
+    executor.execution = CallbackExecution::EXECUTOR;
+    executor.executor = [&pool](std::function<void()> task) { pool.post(std::move(task)); };
+    runCase("EXECUTOR(4线程)", executor, port, count, callbackMicros);
+
+    benchmark::stopMockServerProcess(child);
+    return 0;
+}
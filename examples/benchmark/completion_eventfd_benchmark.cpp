@@ -0,0 +1,176 @@
+/**
+ * @file completion_eventfd_benchmark.cpp
+ * @brief 单线程事件循环消费SDK回调：每个回调写一次eventfd / SDK完成队列（EVENT_FD）
+ *
+ * 调用方的单线程事件循环（epoll）驱动若干台机器狗的导航任务：每台保持固定数量的任务在途，
+ * 导航结果回调中立即下发下一个任务。所有SDK实例共享一个运行时。
+ * 1. EXECUTOR：执行器把回调放入调用方自己的队列，每个回调写一次eventfd（常见的简单接入方式）；
+ * 2. EVENT_FD：SDK的完成队列，两次 drainCompletions() 之间只写一次eventfd。
+ * 输出事件循环被唤醒的次数、每次唤醒处理的回调数、eventfd写入次数和CPU时间。
+ *
+ * 模拟服务端运行在fork出的子进程中。
+ *
+ * 用法: completion_eventfd_benchmark [回调总数] [机器狗数] [每台在途任务数]
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+/**
+ * @brief 调用方自己的回调队列：每个回调写一次eventfd
+ */
+class NaiveEventQueue {
+public:
+    NaiveEventQueue() : fd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {}
+    ~NaiveEventQueue() { close(fd_); }
+
+    int fd() const { return fd_; }
+    uint64_t writes() const { return writes_; }
+
+    void post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        uint64_t one = 1;
+        ssize_t ignored = write(fd_, &one, sizeof(one));
+        (void)ignored;
+        ++writes_;
+    }
+
+    std::size_t drain() {
+        uint64_t value = 0;
+        ssize_t ignored = read(fd_, &value, sizeof(value));
+        (void)ignored;
+        std::deque<std::function<void()>> tasks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks.swap(tasks_);
+        }
+        for (auto& task : tasks) {
+            task();
+        }
+        return tasks.size();
+    }
+
+private:
+    int fd_;
+    std::mutex mutex_;
+    std::deque<std::function<void()>> tasks_;
+    std::atomic<uint64_t> writes_{0};
+};
+
+void runCase(const char* name, bool eventFd, uint16_t port, int total, int robots, int inFlight) {
+    auto runtime = std::make_shared<SdkRuntime>(1);
+    NaiveEventQueue naive;
+
+    SdkOptions options;
+    options.runtime = runtime;
+    if (eventFd) {
+        options.callbacks.execution = CallbackExecution::EVENT_FD;
+    } else {
+        options.callbacks.execution = CallbackExecution::EXECUTOR;
+        options.callbacks.executor = [&naive](std::function<void()> task) { naive.post(std::move(task)); };
+    }
+
+    std::vector<std::unique_ptr<RobotServerSdk>> sdks;
+    for (int i = 0; i < robots; ++i) {
+        sdks.emplace_back(new RobotServerSdk(options));
+        if (!sdks.back()->connect("127.0.0.1", port)) {
+            std::cerr << name << ": 连接失败" << std::endl;
+            return;
+        }
+    }
+
+    int fd = eventFd ? runtime->completionEventFd() : naive.fd();
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &event);
+
+    std::vector<NavigationPoint> points(4);
+    int completed = 0;
+    int issued = 0;
+    std::function<void(RobotServerSdk&)> start = [&](RobotServerSdk& sdk) {
+        ++issued;
+        sdk.request1003_StartNavTask(points, [&, sdkPtr = &sdk](const NavigationResult&) {
+            ++completed;
+            if (issued < total) {
+                start(*sdkPtr);
+            }
+        });
+    };
+
+    double cpuStart = benchmark::processCpuMicroseconds();
+    auto wallStart = std::chrono::steady_clock::now();
+    for (auto& sdk : sdks) {
+        for (int i = 0; i < inFlight && issued < total; ++i) {
+            start(*sdk);
+        }
+    }
+
+    uint64_t wakeups = 0;
+    while (completed < issued) {
+        epoll_event ready{};
+        if (epoll_wait(epfd, &ready, 1, 1000) <= 0) {
+            continue;
+        }
+        ++wakeups;
+        if (eventFd) {
+            runtime->drainCompletions();
+        } else {
+            naive.drain();
+        }
+    }
+    double wall = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallStart).count();
+    double cpu = benchmark::processCpuMicroseconds() - cpuStart;
+    close(epfd);
+
+    uint64_t writes = eventFd ? wakeups : naive.writes();
+    std::printf("%-12s 回调%d次 耗时%.0fms  事件循环唤醒%llu次（每次%.1f个回调） eventfd写入约%llu次  每个回调CPU时间%.1fus\n",
+                name, completed, wall, static_cast<unsigned long long>(wakeups),
+                wakeups ? static_cast<double>(completed) / wakeups : 0.0, static_cast<unsigned long long>(writes),
+                cpu / completed);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int total = argc > 1 ? std::atoi(argv[1]) : 20000;
+    int robots = argc > 2 ? std::atoi(argv[2]) : 4;
+    int inFlight = argc > 3 ? std::atoi(argv[3]) : 8;
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+
+    std::cout << "单线程事件循环消费导航结果回调（" << robots << "台机器狗，每台在途" << inFlight
+              << "个任务，模拟服务端端口 " << port << "）" << std::endl;
+    runCase("EXECUTOR", false, port, total, robots, inFlight);
+    runCase("EVENT_FD", true, port, total, robots, inFlight);
+
+    benchmark::stopMockServerProcess(child);
+    return 0;
+}
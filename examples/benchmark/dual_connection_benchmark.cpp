@@ -0,0 +1,142 @@
+/**
+ * @file dual_connection_benchmark.cpp
+ * @brief 遥测满载时运动控制命令的往返时延：单连接与独立控制连接对比
+ *
+ * 多个线程持续轮询 1002/2102/2103，另一个线程不断下发多航点的 1003 导航任务，
+ * 模拟服务端按固定速率读取每条连接（模拟带宽受限的链路），SDK的socket发送缓冲区调小，
+ * 使积压留在SDK的发送队列中。主线程周期性发送 request2_ActionControl(STAND_UP)，
+ * 测量其往返时延，并输出SDK统计的每条连接的往返时延。
+ *
+ * 单连接时运动控制命令排在遥测和导航任务之后；独立控制连接时运动控制命令有自己的队列和socket。
+ *
+ * 用法: dual_connection_benchmark [命令次数] [轮询线程数] [链路速率KB/s]
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+// 同时未完成的导航任务上限
+constexpr int MAX_NAV_TASKS_IN_FLIGHT = 64;
+
+// 每个导航任务的航点数
+constexpr int NAV_POINTS = 60;
+
+void printChannel(const std::string& name, const char* channel, const ConnectionStatistics& stats) {
+    std::printf("%-28s %s连接: 往返时延 平滑%.2fms 最小%.2fms 最大%.2fms (%llu个样本)  最大队列深度%llu帧\n",
+                name.c_str(), channel, stats.rttSmoothedMicros / 1000.0, stats.rttMinMicros / 1000.0,
+                stats.rttMaxMicros / 1000.0, static_cast<unsigned long long>(stats.rttSamples),
+                static_cast<unsigned long long>(stats.maxQueueDepth));
+}
+
+void runCase(const std::string& name, TransportBackend backend, bool dedicated, uint16_t port,
+             int samples, int pollers) {
+    SdkOptions options;
+    options.transport = backend;
+    options.dedicatedControlConnection = dedicated;
+    options.socket.sendBufferSize = 16 * 1024;
+    options.sendQueue.queries = SendQueuePolicy::ENQUEUE;  // 让轮询请求持续占满队列
+    options.sendQueue.maxQueuedFrames = 0;
+    options.requestTimeout = std::chrono::milliseconds(10000);
+    RobotServerSdk sdk(options);
+    if (!sdk.connect("127.0.0.1", port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> load;
+    for (int t = 0; t < pollers; ++t) {
+        load.emplace_back([&sdk, &stop, t]() {
+            while (!stop) {
+                switch (t % 3) {
+                case 0: sdk.request1002_RunTimeState(); break;
+                case 1: sdk.request2102_RTKFusionData(); break;
+                default: sdk.request2103_RTKRawData(); break;
+                }
+            }
+        });
+    }
+    load.emplace_back([&]() {
+        std::vector<NavigationPoint> points(NAV_POINTS);
+        for (int i = 0; i < NAV_POINTS; ++i) {
+            points[i].value = i;
+            points[i].posX = i * 0.5;
+        }
+        std::atomic<int> inFlight{0};
+        while (!stop) {
+            if (inFlight >= MAX_NAV_TASKS_IN_FLIGHT) {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                continue;
+            }
+            ++inFlight;
+            sdk.request1003_StartNavTask(points, [&inFlight](const NavigationResult&) { --inFlight; });
+        }
+        // 等待所有导航任务结束，回调引用了局部变量
+        while (inFlight > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    benchmark::LatencyStats stats;
+    for (int i = 0; i < samples; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        MotionControlResult result = sdk.request2_ActionControl(ActionCommand::STAND_UP);
+        if (result.errorCode == ErrorCode_MotionControl::SUCCESS) {
+            stats.add(std::chrono::steady_clock::now() - start);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    stop = true;
+    for (auto& thread : load) {
+        thread.join();
+    }
+
+    stats.print(name.c_str());
+    printChannel(name, "控制", sdk.getConnectionStatistics(ConnectionChannel::CONTROL));
+    printChannel(name, "数据", sdk.getConnectionStatistics(ConnectionChannel::DATA));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int samples = argc > 1 ? std::atoi(argv[1]) : 50;
+    int pollers = argc > 2 ? std::atoi(argv[2]) : 3;
+    std::size_t rate = (argc > 3 ? std::atoi(argv[3]) : 2048) * 1024;
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child, std::string(), rate);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+
+    std::cout << "运动控制命令往返时延（" << pollers << "个轮询线程 + 连续导航任务下发，每条连接 " << rate / 1024
+              << "KB/s，模拟服务端端口 " << port << "）" << std::endl;
+    const std::pair<const char*, TransportBackend> backends[] = {
+        {"ASIO", TransportBackend::ASIO},
+        {"EPOLL", TransportBackend::EPOLL},
+        {"IO_URING", TransportBackend::IO_URING},
+    };
+    for (const auto& backend : backends) {
+        std::string name = backend.first;
+        runCase(name + " 单连接", backend.second, false, port, samples, pollers);
+        runCase(name + " 独立控制连接", backend.second, true, port, samples, pollers);
+    }
+
+    benchmark::stopMockServerProcess(child);
+    return 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file estop_latency_benchmark.cpp
+ * @brief 遥测满载时软急停命令的往返时延：优先通道开启与关闭对比
+ *
+ * 模拟服务端按固定速率读取请求（模拟带宽受限的无线链路），SDK的socket发送缓冲区调小，
+ * 使积压留在SDK的发送队列中。多个线程持续轮询 request1002_RunTimeState，
+ * 另一个线程不断下发多航点的 1003 导航任务。
+ * 主线程周期性发送 request2_ActionControl(SOFT_EMERGENCY_STOP)，测量其往返时延。
+ * 优先通道开启时急停帧排在所有尚未写出的帧之前，只需等待当前写操作完成。
+ *
+ * 模拟服务端运行在fork出的子进程中。
+ *
+ * 用法: estop_latency_benchmark [急停次数] [轮询线程数] [链路速率KB/s]
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+// 同时未完成的导航任务上限
+constexpr int MAX_NAV_TASKS_IN_FLIGHT = 64;
+
+// 每个导航任务的航点数
+constexpr int NAV_POINTS = 60;
+
+void runCase(const std::string& name, TransportBackend backend, bool prioritize, bool loaded,
+             uint16_t port, int samples, int pollers) {
+    SdkOptions options;
+    options.transport = backend;
+    options.socket.sendBufferSize = 16 * 1024;
+    options.sendQueue.prioritizeSafetyCommands = prioritize;
+    options.sendQueue.queries = SendQueuePolicy::ENQUEUE;  // 让轮询请求持续占满队列
+    options.sendQueue.maxQueuedFrames = 0;
+    options.requestTimeout = std::chrono::milliseconds(10000);
+    RobotServerSdk sdk(options);
+    if (!sdk.connect("127.0.0.1", port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> load;
+    if (loaded) {
+        for (int t = 0; t < pollers; ++t) {
+            load.emplace_back([&]() {
+                while (!stop) {
+                    sdk.request1002_RunTimeState();
+                }
+            });
+        }
+        load.emplace_back([&]() {
+            std::vector<NavigationPoint> points(NAV_POINTS);
+            for (int i = 0; i < NAV_POINTS; ++i) {
+                points[i].value = i;
+                points[i].posX = i * 0.5;
+            }
+            std::atomic<int> inFlight{0};
+            while (!stop) {
+                if (inFlight >= MAX_NAV_TASKS_IN_FLIGHT) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                    continue;
+                }
+                ++inFlight;
+                sdk.request1003_StartNavTask(points, [&inFlight](const NavigationResult&) { --inFlight; });
+            }
+            // 等待所有导航任务结束，回调引用了局部变量
+            while (inFlight > 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    benchmark::LatencyStats stats;
+    uint64_t depthSum = 0;
+    for (int i = 0; i < samples; ++i) {
+        depthSum += sdk.getConnectionStatistics().queueDepth;
+        auto start = std::chrono::steady_clock::now();
+        MotionControlResult result = sdk.request2_ActionControl(ActionCommand::SOFT_EMERGENCY_STOP);
+        if (result.errorCode == ErrorCode_MotionControl::SUCCESS) {
+            stats.add(std::chrono::steady_clock::now() - start);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    stop = true;
+    for (auto& thread : load) {
+        thread.join();
+    }
+
+    stats.print(name.c_str());
+    std::printf("%-24s 发送时队列平均深度 %.1f帧\n", name.c_str(), static_cast<double>(depthSum) / samples);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int samples = argc > 1 ? std::atoi(argv[1]) : 50;
+    int pollers = argc > 2 ? std::atoi(argv[2]) : 4;
+    std::size_t rate = (argc > 3 ? std::atoi(argv[3]) : 2048) * 1024;
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child, std::string(), rate);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+
+    std::cout << "软急停往返时延（" << pollers << "个轮询线程 + 连续导航任务下发，链路 " << rate / 1024
+              << "KB/s，模拟服务端端口 " << port << "）" << std::endl;
+    const std::pair<const char*, TransportBackend> backends[] = {
+        {"ASIO", TransportBackend::ASIO},
+        {"EPOLL", TransportBackend::EPOLL},
+        {"IO_URING", TransportBackend::IO_URING},
+    };
+    for (const auto& backend : backends) {
+        std::string name = backend.first;
+        runCase(name + " 空载", backend.second, true, false, port, samples, pollers);
+        runCase(name + " 满载 无优先", backend.second, false, true, port, samples, pollers);
+        runCase(name + " 满载 优先通道", backend.second, true, true, port, samples, pollers);
+    }
+
+    benchmark::stopMockServerProcess(child);
+    return 0;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file many_connections_benchmark.cpp
+ * @brief 大量连接下的传输层吞吐量对比：Boost.Asio、原生 epoll 与 io_uring
+ *
+ * 用 FleetSdk 向同一个模拟服务端建立大量连接（模拟网关同时管理的机器狗），
+ * 每轮对所有连接并发发送 request1002_RunTimeState 并等待全部应答，测量：
+ *  - 每秒完成的请求数；
+ *  - 每条消息（请求+应答）消耗的本进程CPU时间。
+ *
+ * 模拟服务端运行在fork出的子进程中，CPU时间只统计SDK所在进程。
+ *
+ * 用法: many_connections_benchmark [连接数] [轮数]
+ */
+
+#include <fleet_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+void runCase(const char* name, TransportBackend backend, uint16_t port, int connections, int rounds) {
+    SdkOptions options;
+    options.transport = backend;
+    FleetSdk fleet(options);
+
+    std::vector<RobotEndpoint> robots;
+    for (int i = 0; i < connections; ++i) {
+        robots.push_back(RobotEndpoint{"robot" + std::to_string(i), "127.0.0.1", port});
+    }
+    auto connected = fleet.addRobots(robots);
+    int connectedCount = 0;
+    for (const auto& entry : connected) {
+        connectedCount += entry.second ? 1 : 0;
+    }
+    if (connectedCount != connections) {
+        std::cerr << name << ": 只建立了 " << connectedCount << "/" << connections << " 个连接" << std::endl;
+    }
+
+    // 预热
+    for (int i = 0; i < 5; ++i) {
+        fleet.requestAll1002_RunTimeState();
+    }
+
+    long long succeeded = 0;
+    double cpu_before = benchmark::processCpuMicroseconds();
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (const auto& entry : fleet.requestAll1002_RunTimeState()) {
+            if (entry.second.errorCode == ErrorCode_RealTimeStatus::SUCCESS) {
+                ++succeeded;
+            }
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double cpu = benchmark::processCpuMicroseconds() - cpu_before;
+
+    std::printf("%-10s %d连接 x %d轮: %lld条 %.0f条/秒  CPU %.1fus/条\n",
+                name, connectedCount, rounds, succeeded, succeeded / seconds,
+                cpu / std::max(succeeded, 1LL));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int connections = argc > 1 ? std::atoi(argv[1]) : 256;
+    int rounds = argc > 2 ? std::atoi(argv[2]) : 200;
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+
+    std::cout << "request1002_RunTimeState 多连接吞吐量对比（模拟服务端端口 " << port << "）" << std::endl;
+    runCase("ASIO", TransportBackend::ASIO, port, connections, rounds);
+    runCase("EPOLL", TransportBackend::EPOLL, port, connections, rounds);
+    runCase("IO_URING", TransportBackend::IO_URING, port, connections, rounds);
+
+    benchmark::stopMockServerProcess(child);
+    return 0;
+}
@@ -0,0 +1,315 @@
+#pragma once
+
+/**
+ * @file mock_robot_server.hpp
+ * @brief 性能测试用的模拟机器狗服务端
+ *
+ * 按协议格式（16字节协议头 + XML消息体）应答 1002/1003/1004/1007/2102/2103 和运动控制请求，
+ * 运行在独立线程中，使基准测试不依赖真实设备。应答内容固定，只用于测量通信开销。
+ * 可以监听TCP回环地址或Unix域socket路径，可以限制读取速率以模拟带宽受限的链路。
+ */
+
+#include <boost/asio.hpp>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace benchmark {
+
+class MockRobotServer {
+public:
+    using Protocol = boost::asio::generic::stream_protocol;
+
+    /**
+     * @brief 构造并启动监听TCP回环地址的服务端
+     * @param port 监听端口，0表示由系统分配
+     * @param noDelay 服务端socket是否设置TCP_NODELAY
+     * @param readBytesPerSecond 每个连接读取请求的速率上限（字节/秒），0表示不限
+     */
+    explicit MockRobotServer(uint16_t port = 0, bool noDelay = true, std::size_t readBytesPerSecond = 0)
+        : acceptor_(io_context_, Protocol::endpoint(
+              boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), port))),
+          no_delay_(noDelay), read_rate_(readBytesPerSecond) {
+        accept();
+        thread_ = std::thread([this]() { io_context_.run(); });
+    }
+
+    /**
+     * @brief 构造并启动监听Unix域socket的服务端
+     * @param unixPath socket文件路径，已存在时先删除
+     */
+    explicit MockRobotServer(const std::string& unixPath)
+        : acceptor_(io_context_, unixEndpoint(unixPath)), no_delay_(false), unix_path_(unixPath) {
+        accept();
+        thread_ = std::thread([this]() { io_context_.run(); });
+    }
+
+    ~MockRobotServer() {
+        io_context_.stop();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        if (!unix_path_.empty()) {
+            ::unlink(unix_path_.c_str());
+        }
+    }
+
+    MockRobotServer(const MockRobotServer&) = delete;
+    MockRobotServer& operator=(const MockRobotServer&) = delete;
+
+    /**
+     * @brief 获取实际监听的端口
+     */
+    uint16_t port() const {
+        if (!unix_path_.empty()) {
+            return 0;
+        }
+        Protocol::endpoint endpoint = acceptor_.local_endpoint();
+        // sockaddr_in 与 sockaddr_in6 的端口字段位置相同
+        return ntohs(reinterpret_cast<const sockaddr_in*>(endpoint.data())->sin_port);
+    }
+
+    /**
+     * @brief 取出 pending 中所有完整的请求帧，把应答追加到 out
+     *
+     * 不依赖传输方式，共享内存等其他模拟服务端也使用同一套应答。
+     */
+    static void respond(std::string& pending, std::string& out) {
+        std::size_t offset = 0;
+        while (pending.size() - offset >= HEADER_SIZE) {
+            uint16_t length = 0;
+            uint16_t seq = 0;
+            std::memcpy(&length, pending.data() + offset + 4, sizeof(length));
+            std::memcpy(&seq, pending.data() + offset + 6, sizeof(seq));
+            if (pending.size() - offset < HEADER_SIZE + length) {
+                break;
+            }
+            appendResponse(out, pending.substr(offset + HEADER_SIZE, length), seq);
+            offset += HEADER_SIZE + length;
+        }
+        pending.erase(0, offset);
+    }
+
+private:
+    static Protocol::endpoint unixEndpoint(const std::string& path) {
+        ::unlink(path.c_str());
+        return Protocol::endpoint(boost::asio::local::stream_protocol::endpoint(path));
+    }
+
+    static constexpr std::size_t HEADER_SIZE = 16;
+
+    static std::string tagValue(const std::string& body, const std::string& tag, std::size_t from = 0) {
+        std::string open = "<" + tag + ">";
+        std::size_t begin = body.find(open, from);
+        if (begin == std::string::npos) {
+            return "";
+        }
+        begin += open.size();
+        std::size_t end = body.find('<', begin);
+        return body.substr(begin, end - begin);
+    }
+
+    static void appendResponse(std::string& out, const std::string& request, uint16_t seq) {
+        int type = std::atoi(tagValue(request, "Type").c_str());
+        std::string command = tagValue(request, "Command");
+        std::string items;
+        switch (type) {
+        case 2:
+            items = "<Value>" + tagValue(request, "Value") + "</Value><ErrorCode>0</ErrorCode>";
+            break;
+        case 1002:
+            items = "<MotionState>1</MotionState><PosX>1.5</PosX><PosY>-2.25</PosY><PosZ>0</PosZ>"
+                    "<AngleYaw>0.5</AngleYaw><Electricity>87</Electricity><Location>1</Location>";
+            break;
+        case 1003: {
+            // 导航任务立即完成，应答最后一个导航点的编号
+            std::string value;
+            for (std::size_t pos = request.find("<Value>"); pos != std::string::npos;
+                 pos = request.find("<Value>", pos + 1)) {
+                value = tagValue(request, "Value", pos);
+            }
+            items = "<Value>" + value + "</Value><ErrorCode>0</ErrorCode><ErrorStatus>8960</ErrorStatus>";
+            command = "1";
+            break;
+        }
+        case 1004:
+            items = "<ErrorCode>0</ErrorCode>";
+            break;
+        case 1007:
+            items = "<Value>3</Value><Status>1</Status><ErrorCode>0</ErrorCode>";
+            break;
+        case 2102:
+        case 2103:
+            items = "<Longitude>116.5</Longitude><Latitude>39.9</Latitude><ElpHeight>50.25</ElpHeight><Yaw>1.5</Yaw>";
+            break;
+        default:
+            return;
+        }
+
+        std::string body = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<PatrolDevice>\n<Type>" + std::to_string(type) +
+                           "</Type>\n<Command>" + command + "</Command>\n<Time>2025-01-01 00:00:00</Time>\n<Items>" +
+                           items + "</Items>\n</PatrolDevice>";
+
+        std::array<uint8_t, HEADER_SIZE> header{0xeb, 0x90, 0xeb, 0x90};
+        uint16_t length = static_cast<uint16_t>(body.size());
+        std::memcpy(header.data() + 4, &length, sizeof(length));
+        std::memcpy(header.data() + 6, &seq, sizeof(seq));
+        out.append(reinterpret_cast<const char*>(header.data()), header.size());
+        out += body;
+    }
+
+    // 单个客户端连接
+    class Session : public std::enable_shared_from_this<Session> {
+    public:
+        Session(Protocol::socket socket, std::size_t readRate)
+            : socket_(std::move(socket)), read_rate_(readRate), read_timer_(socket_.get_executor()) {}
+
+        void start() { read(); }
+
+    private:
+        void read() {
+            auto self = shared_from_this();
+            // 限速时每次只读约5毫秒的数据量
+            std::size_t size = read_rate_ == 0 ? read_buffer_.size()
+                : std::min(read_buffer_.size(), std::max<std::size_t>(read_rate_ / 200, 1024));
+            socket_.async_read_some(boost::asio::buffer(read_buffer_.data(), size),
+                [this, self](const boost::system::error_code& error, std::size_t bytes) {
+                    if (error) {
+                        return;
+                    }
+                    pending_.append(read_buffer_.data(), bytes);
+                    handleFrames();
+                    if (read_rate_ == 0) {
+                        read();
+                        return;
+                    }
+                    read_timer_.expires_after(std::chrono::microseconds(bytes * 1000000 / read_rate_));
+                    read_timer_.async_wait([this, self](const boost::system::error_code& ec) {
+                        if (!ec) {
+                            read();
+                        }
+                    });
+                });
+        }
+
+        // 取出所有完整的请求帧并生成应答
+        void handleFrames() {
+            std::string out;
+            respond(pending_, out);
+            if (out.empty()) {
+                return;
+            }
+
+            // 应答按顺序写出，写操作进行中时追加到待写缓冲
+            bool idle = writing_.empty() && write_buffer_.empty();
+            write_buffer_ += out;
+            if (idle) {
+                write();
+            }
+        }
+
+        void write() {
+            auto self = shared_from_this();
+            writing_.swap(write_buffer_);
+            boost::asio::async_write(socket_, boost::asio::buffer(writing_),
+                [this, self](const boost::system::error_code& error, std::size_t) {
+                    writing_.clear();
+                    if (!error && !write_buffer_.empty()) {
+                        write();
+                    }
+                });
+        }
+
+        Protocol::socket socket_;
+        std::size_t read_rate_;                  // 读取速率上限（字节/秒），0表示不限
+        boost::asio::steady_timer read_timer_;   // 限速时推迟下一次读取
+        std::array<char, 65536> read_buffer_;
+        std::string pending_;       // 尚未组成完整帧的数据
+        std::string write_buffer_;  // 等待写出的应答
+        std::string writing_;       // 正在写出的应答
+    };
+
+    void accept() {
+        acceptor_.async_accept([this](const boost::system::error_code& error, Protocol::socket socket) {
+            if (!error) {
+                if (unix_path_.empty()) {
+                    socket.set_option(boost::asio::ip::tcp::no_delay(no_delay_));
+                }
+                if (read_rate_ != 0) {
+                    // 限速时缩小接收缓冲区，使积压留在客户端；
+                    // 回环接口的MSS约为64KB，缓冲区再小时接收窗口更新会被推迟，吞吐量时常骤降
+                    socket.set_option(boost::asio::socket_base::receive_buffer_size(64 * 1024));
+                }
+                std::make_shared<Session>(std::move(socket), read_rate_)->start();
+            }
+            accept();
+        });
+    }
+
+    boost::asio::io_context io_context_;
+    boost::asio::basic_socket_acceptor<Protocol> acceptor_;
+    bool no_delay_;
+    std::size_t read_rate_ = 0; // 每个连接的读取速率上限
+    std::string unix_path_; // 监听Unix域socket时的路径
+    std::thread thread_;
+};
+
+/**
+ * @brief 在fork出的子进程中启动模拟服务端，使其CPU开销不计入测试进程
+ * @param child 输出参数，子进程号
+ * @param unixPath 非空时同时在该路径上监听Unix域socket
+ * @param readBytesPerSecond TCP连接读取请求的速率上限（字节/秒），0表示不限
+ * @return TCP监听端口，失败时为0
+ */
+inline uint16_t startMockServerProcess(pid_t& child, const std::string& unixPath = std::string(),
+                                       std::size_t readBytesPerSecond = 0) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return 0;
+    }
+
+    child = fork();
+    if (child == 0) {
+        prctl(PR_SET_PDEATHSIG, SIGKILL);
+        close(fds[0]);
+        MockRobotServer server(0, true, readBytesPerSecond);
+        std::unique_ptr<MockRobotServer> unixServer;
+        if (!unixPath.empty()) {
+            unixServer.reset(new MockRobotServer(unixPath));
+        }
+        uint16_t port = server.port();
+        ssize_t ignored = write(fds[1], &port, sizeof(port));
+        (void)ignored;
+        close(fds[1]);
+        pause();
+        _exit(0);
+    }
+
+    close(fds[1]);
+    uint16_t port = 0;
+    ssize_t ignored = read(fds[0], &port, sizeof(port));
+    (void)ignored;
+    close(fds[0]);
+    return port;
+}
+
+/**
+ * @brief 停止 startMockServerProcess 启动的子进程
+ */
+inline void stopMockServerProcess(pid_t child) {
+    kill(child, SIGKILL);
+    waitpid(child, nullptr, 0);
+}
+
+} // namespace benchmark
@@ -0,0 +1,109 @@
+/**
+ * @file number_parse_benchmark.cpp
+ * @brief 响应中数值字段的解码耗时：std::stringstream / strtod / std::from_chars 对比
+ *
+ * 每类响应先扫描一次得到字段视图，之后只测量把 Items 下全部字段转换为数值的耗时（每条消息）：
+ * 1. stringstream：每个字段构造一个 std::stringstream（原 get_node_value 的做法）；
+ * 2. strtod：字段拷贝到栈上补0后调用 strtod；
+ * 3. from_chars：protocol::readNumber，整个文本必须是数值；
+ * 另外给出写入消息对象的两种方式：
+ * 4. 逐字段查找：每个字段按名字线性查找元素后解析（字段数的平方次比较，原 get_node_value 的做法）；
+ * 5. deserializeFields：按字段表遍历一次元素，编译期完美哈希分派到成员。
+ *
+ * 用法: number_parse_benchmark [每类响应的解码次数]
+ */
+
+#include "protocol/messages.hpp"
+#include "protocol/patrol_scanner.hpp"
+#include "recorded_responses.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+namespace {
+
+double decodeStringstream(const protocol::PatrolFields& fields) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < fields.itemCount; ++i) {
+        std::stringstream ss(std::string(fields.items[i].value));
+        double value = 0.0;
+        ss >> value;
+        sum += value;
+    }
+    return sum;
+}
+
+double decodeStrtod(const protocol::PatrolFields& fields) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < fields.itemCount; ++i) {
+        std::string_view text = fields.items[i].value;
+        char buffer[64];
+        std::size_t size = std::min(text.size(), sizeof(buffer) - 1);
+        std::memcpy(buffer, text.data(), size);
+        buffer[size] = '\0';
+        sum += std::strtod(buffer, nullptr);
+    }
+    return sum;
+}
+
+double decodeFromChars(const protocol::PatrolFields& fields) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < fields.itemCount; ++i) {
+        double value = 0.0;
+        protocol::readNumber(fields.items[i].value, value);
+        sum += value;
+    }
+    return sum;
+}
+
+double decodeByLookup(const protocol::PatrolFields& fields) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < fields.itemCount; ++i) {
+        double value = 0.0;
+        fields.readItem(fields.items[i].name, value);
+        sum += value;
+    }
+    return sum;
+}
+
+template <typename Decode>
+double measure(int count, double& checksum, Decode decode) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        checksum += decode();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 200000;
+    double checksum = 0.0;
+
+    std::printf("%-16s %6s %14s %12s %12s %14s %18s\n", "响应", "字段数", "stringstream", "strtod", "from_chars",
+                "逐字段查找", "deserializeFields");
+    for (const benchmark::RecordedResponse& response : benchmark::recordedResponses()) {
+        protocol::PatrolFields fields;
+        if (!protocol::scanPatrolDevice(response.body.data(), response.body.size(), fields)) {
+            std::fprintf(stderr, "%s: 扫描失败\n", response.name);
+            return 1;
+        }
+        auto message = protocol::createMessage(response.type);
+
+        double stream = measure(count, checksum, [&]() { return decodeStringstream(fields); });
+        double strtodNs = measure(count, checksum, [&]() { return decodeStrtod(fields); });
+        double fromChars = measure(count, checksum, [&]() { return decodeFromChars(fields); });
+        double lookup = measure(count, checksum, [&]() { return decodeByLookup(fields); });
+        double messageNs = measure(count, checksum, [&]() { return message->deserializeFields(fields) ? 1.0 : 0.0; });
+
+        std::printf("%-16s %6zu %12.0fns %10.0fns %10.0fns %12.0fns %16.0fns\n", response.name, fields.itemCount, stream,
+                    strtodNs, fromChars, lookup, messageNs);
+    }
+    std::printf("(校验和 %.1f)\n", checksum);
+    return 0;
+}
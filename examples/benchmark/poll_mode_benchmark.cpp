@@ -0,0 +1,121 @@
+/**
+ * @file poll_mode_benchmark.cpp
+ * @brief 调用方驱动IO（无后台IO线程）与IO线程模式的往返时延和CPU开销对比
+ *
+ * 1. IO线程：默认模式，同步请求 request1002_RunTimeState，响应由IO线程接收后唤醒调用线程；
+ * 2. 调用方驱动 同步请求：SdkOptions::callerDrivenIo，同步请求在调用线程中自行驱动收发，没有跨线程交接；
+ * 3. 调用方驱动 epoll循环：把 nativeHandle() 加入调用方自己的epoll，
+ *    在事件循环中下发导航任务，socket可读时调用 poll()，导航结果回调在事件循环线程中执行。
+ *
+ * 模拟服务端运行在fork出的子进程中。
+ *
+ * 用法: poll_mode_benchmark [请求数]
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+void printCpu(const char* name, double cpuMicros, int count) {
+    std::printf("%-24s 每次请求CPU时间 %.1fus\n", name, cpuMicros / count);
+}
+
+void runSyncCase(const char* name, bool callerDriven, uint16_t port, int count) {
+    SdkOptions options;
+    options.callerDrivenIo = callerDriven;
+    RobotServerSdk sdk(options);
+    if (!sdk.connect("127.0.0.1", port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    benchmark::LatencyStats stats;
+    double cpuStart = benchmark::processCpuMicroseconds();
+    for (int i = 0; i < count; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        if (sdk.request1002_RunTimeState().errorCode == ErrorCode_RealTimeStatus::SUCCESS) {
+            stats.add(std::chrono::steady_clock::now() - start);
+        }
+    }
+    double cpu = benchmark::processCpuMicroseconds() - cpuStart;
+
+    stats.print(name);
+    printCpu(name, cpu, count);
+}
+
+void runEventLoopCase(const char* name, uint16_t port, int count) {
+    SdkOptions options;
+    options.callerDrivenIo = true;
+    RobotServerSdk sdk(options);
+    if (!sdk.connect("127.0.0.1", port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = sdk.nativeHandle();
+    if (epfd < 0 || epoll_ctl(epfd, EPOLL_CTL_ADD, event.data.fd, &event) != 0) {
+        std::cerr << name << ": 无法监听socket" << std::endl;
+        if (epfd >= 0) {
+            close(epfd);
+        }
+        return;
+    }
+
+    std::vector<NavigationPoint> points(4);
+    benchmark::LatencyStats stats;
+    double cpuStart = benchmark::processCpuMicroseconds();
+    for (int i = 0; i < count; ++i) {
+        bool done = false;
+        auto start = std::chrono::steady_clock::now();
+        sdk.request1003_StartNavTask(points, [&done](const NavigationResult&) { done = true; });
+        // 写出请求，之后只在socket可读时处理
+        sdk.poll();
+        while (!done) {
+            // 超时后也调用一次，推进定时器
+            epoll_event ready{};
+            epoll_wait(epfd, &ready, 1, 100);
+            sdk.poll();
+        }
+        stats.add(std::chrono::steady_clock::now() - start);
+    }
+    double cpu = benchmark::processCpuMicroseconds() - cpuStart;
+    close(epfd);
+
+    stats.print(name);
+    printCpu(name, cpu, count);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 5000;
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+
+    std::cout << "调用方驱动IO与IO线程模式对比（模拟服务端端口 " << port << "）" << std::endl;
+    runSyncCase("IO线程", false, port, count);
+    runSyncCase("调用方驱动 同步请求", true, port, count);
+    runEventLoopCase("调用方驱动 epoll循环", port, count);
+
+    benchmark::stopMockServerProcess(child);
+    return 0;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+/**
+ * @file recorded_responses.hpp
+ * @brief 协议层性能测试共用的设备响应样本
+ */
+
+#include "protocol/message_interface.hpp"
+
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ * @brief 一类响应的消息体
+ */
+struct RecordedResponse {
+    const char* name;
+    protocol::MessageType type;
+    std::string body;
+};
+
+// 按协议格式拼出消息体
+inline std::string patrolDevice(int type, int command, const std::string& items) {
+    return "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<PatrolDevice>\n<Type>" + std::to_string(type) +
+           "</Type>\n<Command>" + std::to_string(command) + "</Command>\n<Time>2025-01-01 00:00:00</Time>\n<Items>\n" +
+           items + "</Items>\n</PatrolDevice>";
+}
+
+// 设备返回的响应
+inline std::vector<RecordedResponse> recordedResponses() {
+    return {
+        {"1002 实时状态", protocol::MessageType::GET_REAL_TIME_STATUS_RESP,
+         patrolDevice(1002, 1,
+                      "<MotionState>1</MotionState>\n<PosX>12.345678</PosX>\n<PosY>-23.456789</PosY>\n<PosZ>0.125</PosZ>\n"
+                      "<AngleYaw>1.5707963</AngleYaw>\n<Roll>0.0123</Roll>\n<Pitch>-0.0456</Pitch>\n<Yaw>1.5707963</Yaw>\n"
+                      "<Speed>0.85</Speed>\n<CurOdom>152.75</CurOdom>\n<SumOdom>98213.5</SumOdom>\n<CurRuntime>3600</CurRuntime>\n"
+                      "<SumRuntime>8640000</SumRuntime>\n<Res>0.05</Res>\n<X0>-100.0</X0>\n<Y0>-100.0</Y0>\n<H>4000</H>\n"
+                      "<Electricity>87</Electricity>\n<Location>1</Location>\n<RTKState>4</RTKState>\n"
+                      "<OnDockState>0</OnDockState>\n<GaitState>1</GaitState>\n<MotorState>0</MotorState>\n"
+                      "<ChargeState>0</ChargeState>\n<ControlMode>1</ControlMode>\n<MapUpdateState>0</MapUpdateState>\n")},
+        {"1003 导航任务", protocol::MessageType::NAVIGATION_TASK_RESP,
+         patrolDevice(1003, 1, "<Value>17</Value>\n<ErrorCode>0</ErrorCode>\n<ErrorStatus>0</ErrorStatus>\n")},
+        {"1007 任务状态", protocol::MessageType::QUERY_STATUS_RESP,
+         patrolDevice(1007, 1, "<Value>17</Value>\n<Status>1</Status>\n<ErrorCode>1</ErrorCode>\n")},
+        {"2102 RTK融合", protocol::MessageType::RTK_FUSION_DATA_RESP,
+         patrolDevice(2102, 1, "<Longitude>116.397128</Longitude>\n<Latitude>39.916527</Latitude>\n"
+                               "<ElpHeight>43.5</ElpHeight>\n<Yaw>87.25</Yaw>\n")},
+        {"2 运动控制", protocol::MessageType::MOTION_CONTROL_RESP,
+         patrolDevice(2, 21, "<Value>0.5</Value>\n<ErrorCode>0</ErrorCode>\n")},
+    };
+}
+
+} // namespace benchmark
@@ -0,0 +1,217 @@
+/**
+ * @file serialize_alloc_benchmark.cpp
+ * @brief 请求序列化的耗时和堆分配次数：std::stringstream 与复用缓冲区 + std::to_chars 对比
+ *
+ * 替换全局 operator new 统计堆分配次数，对导航任务（大量导航点）、运动控制、获取实时状态三类请求：
+ * 1. stringstream：每条消息构造 std::stringstream 并返回新的 std::string（原 serialize() 的做法）；
+ * 2. 发送路径：从发送队列的缓冲区池取出消息体，serializeFrame 追加写入，再入队、写出、归还，
+ *    与网络层 sendMessage → 写操作完成的过程相同，但不经过 socket。
+ * 预热后发送路径出现任何堆分配时返回非0，可作为回归检查。
+ *
+ * 用法: serialize_alloc_benchmark [每类请求的序列化次数] [导航点数]
+ */
+
+#include "network/outbound_queue.hpp"
+#include "protocol/messages.hpp"
+#include "protocol/serializer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::atomic<uint64_t> g_allocations{0};
+
+void* countedAlloc(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// 原 NavigationTaskRequest::serialize() 的做法
+std::string serializeWithStringstream(const protocol::NavigationTaskRequest& request) {
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    ss << "<PatrolDevice>\n";
+    ss << "<Type>1003</Type>\n";
+    ss << "<Command>1</Command>\n";
+    ss << "<Time>" << request.timestamp << "</Time>\n";
+    for (const auto& point : request.points) {
+        ss << "<Items>\n";
+        ss << "  <MapId>" << point.mapId << "</MapId>\n";
+        ss << "  <Value>" << point.value << "</Value>\n";
+        ss << "  <PosX>" << point.posX << "</PosX>\n";
+        ss << "  <PosY>" << point.posY << "</PosY>\n";
+        ss << "  <PosZ>" << point.posZ << "</PosZ>\n";
+        ss << "  <AngleYaw>" << point.angleYaw << "</AngleYaw>\n";
+        ss << "  <PointInfo>" << point.pointInfo << "</PointInfo>\n";
+        ss << "  <Gait>" << point.gait << "</Gait>\n";
+        ss << "  <Speed>" << point.speed << "</Speed>\n";
+        ss << "  <Manner>" << point.manner << "</Manner>\n";
+        ss << "  <ObsMode>" << point.obsMode << "</ObsMode>\n";
+        ss << "  <NavMode>" << point.navMode << "</NavMode>\n";
+        ss << "  <Terrain>" << point.terrain << "</Terrain>\n";
+        ss << "  <Posture>" << point.posture << "</Posture>\n";
+        ss << "</Items>\n";
+    }
+    ss << "</PatrolDevice>";
+    return ss.str();
+}
+
+std::string serializeWithStringstream(const protocol::MotionControlRequest& request) {
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    ss << "<PatrolDevice>\n";
+    ss << "<Type>2</Type>\n";
+    ss << "<Command>" << request.command << "</Command>\n";
+    ss << "<Time>" << request.timestamp << "</Time>\n";
+    ss << "<Items>\n";
+    ss << "  <Value>" << std::get<float>(request.value) << "</Value>\n";
+    ss << "</Items>\n";
+    ss << "</PatrolDevice>";
+    return ss.str();
+}
+
+std::string serializeWithStringstream(const protocol::GetRealTimeStatusRequest& request) {
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    ss << "<PatrolDevice>\n";
+    ss << "<Type>1002</Type>\n";
+    ss << "<Command>1</Command>\n";
+    ss << "<Time>" << request.timestamp << "</Time>\n";
+    ss << "<Items/>\n";
+    ss << "</PatrolDevice>";
+    return ss.str();
+}
+
+struct Result {
+    double nsPerMessage = 0.0;
+    double allocationsPerMessage = 0.0;
+    std::size_t bodySize = 0;
+};
+
+template <typename Request>
+Result measureStringstream(const Request& request, int count) {
+    std::size_t size = 0;
+    uint64_t allocations = g_allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        size += serializeWithStringstream(request).size();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return Result{std::chrono::duration<double, std::nano>(elapsed).count() / count,
+                  static_cast<double>(g_allocations.load() - allocations) / count, size / count};
+}
+
+// 与网络层相同的发送过程：取缓冲区 → 序列化 → 入队 → 写出批次 → 完成后归还
+std::size_t sendOnce(network::OutboundQueue& queue, const protocol::IMessage& message, std::vector<iovec>& iov) {
+    protocol::Serializer serializer;
+    protocol::SerializedFrame frame;
+    frame.body = queue.acquireBody();
+    serializer.serializeFrame(message, frame);
+    std::size_t size = frame.body.size();
+
+    queue.push(std::move(frame));
+    queue.beginBatch();
+    std::size_t bytes = queue.batchBytes();
+    queue.gatherBatch(0, 64, iov);
+    queue.completeBatch(bytes);
+    return size;
+}
+
+Result measureSendPath(network::OutboundQueue& queue, const protocol::IMessage& message, int count,
+                       std::vector<iovec>& iov) {
+    // 预热：缓冲区池、各通道和 iov 达到稳定容量
+    for (int i = 0; i < 16; ++i) {
+        sendOnce(queue, message, iov);
+    }
+
+    std::size_t size = 0;
+    uint64_t allocations = g_allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        size += sendOnce(queue, message, iov);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return Result{std::chrono::duration<double, std::nano>(elapsed).count() / count,
+                  static_cast<double>(g_allocations.load() - allocations) / count, size / count};
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 20000;
+    int pointCount = argc > 2 ? std::atoi(argv[2]) : 500;
+
+    protocol::NavigationTaskRequest navigation;
+    for (int i = 0; i < pointCount; ++i) {
+        protocol::NavigationPoint point;
+        point.mapId = 1;
+        point.value = i;
+        point.posX = 12.345678 + i * 0.25;
+        point.posY = -3.5 + i * 0.125;
+        point.posZ = 0.1;
+        point.angleYaw = 1.5707963 - i * 0.001;
+        point.gait = 0x3002;
+        point.speed = 1;
+        navigation.points.push_back(point);
+    }
+
+    protocol::MotionControlRequest motion;
+    motion.command = 11;
+    motion.setValue(0.35f);
+
+    protocol::GetRealTimeStatusRequest status;
+
+    network::OutboundQueue queue;
+    std::vector<iovec> iov;
+    iov.reserve(64);
+
+    struct Case {
+        const char* name;
+        Result legacy;
+        Result sendPath;
+    };
+    std::vector<Case> cases;
+    cases.reserve(3);
+    // 导航任务请求较大，次数按导航点数折算
+    int navigationCount = std::max(1, count * 10 / std::max(1, pointCount));
+    cases.push_back({"导航任务", measureStringstream(navigation, navigationCount),
+                     measureSendPath(queue, navigation, navigationCount, iov)});
+    cases.push_back({"运动控制", measureStringstream(motion, count), measureSendPath(queue, motion, count, iov)});
+    cases.push_back({"获取实时状态", measureStringstream(status, count), measureSendPath(queue, status, count, iov)});
+
+    bool allocationFree = true;
+    std::printf("%-16s %8s %14s %10s %14s %10s\n", "请求", "消息体", "stringstream", "分配/条", "发送路径", "分配/条");
+    for (const Case& c : cases) {
+        std::printf("%-16s %7zuB %12.0fns %10.1f %12.0fns %10.1f\n", c.name, c.sendPath.bodySize, c.legacy.nsPerMessage,
+                    c.legacy.allocationsPerMessage, c.sendPath.nsPerMessage, c.sendPath.allocationsPerMessage);
+        allocationFree = allocationFree && c.sendPath.allocationsPerMessage == 0.0;
+    }
+
+    if (!allocationFree) {
+        std::fprintf(stderr, "发送路径在预热后仍有堆分配\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+/**
+ * @file shm_mock_robot_server.hpp
+ * @brief 性能测试用的共享内存模拟服务端
+ *
+ * 创建 TransportBackend::SHARED_MEMORY 使用的共享内存段，在独立线程中读取请求帧，
+ * 应答内容与 MockRobotServer 相同。
+ */
+
+#include "mock_robot_server.hpp"
+#include "network/shm_ring.hpp"
+
+#include <sys/mman.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace benchmark {
+
+class ShmMockRobotServer {
+public:
+    /**
+     * @brief 创建共享内存段并启动服务端
+     * @param name 共享内存段名
+     * @param ringCapacity 每个环的字节数
+     */
+    explicit ShmMockRobotServer(const std::string& name, std::size_t ringCapacity = 1 << 20)
+        : segment_(network::ShmSegment::create(name, ringCapacity)) {
+        thread_ = std::thread([this]() { run(); });
+    }
+
+    ~ShmMockRobotServer() {
+        stop_ = true;
+        segment_->toServer().wakeConsumer();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    ShmMockRobotServer(const ShmMockRobotServer&) = delete;
+    ShmMockRobotServer& operator=(const ShmMockRobotServer&) = delete;
+
+private:
+    void run() {
+        network::ShmRing& requests = segment_->toServer();
+        network::ShmRing& responses = segment_->toClient();
+        std::vector<char> buffer(65536);
+        std::string pending;
+        std::string out;
+
+        while (!stop_) {
+            if (!requests.waitReadable(std::chrono::milliseconds(100))) {
+                continue;
+            }
+            std::size_t bytes = requests.read(buffer.data(), buffer.size());
+            pending.append(buffer.data(), bytes);
+
+            out.clear();
+            MockRobotServer::respond(pending, out);
+
+            // 客户端按字节流解码，应答可以分段写入
+            std::size_t offset = 0;
+            while (offset < out.size() && !stop_) {
+                std::size_t chunk = std::min(out.size() - offset, responses.capacity() / 2);
+                iovec iov{&out[offset], chunk};
+                if (responses.tryWrite(&iov, 1)) {
+                    offset += chunk;
+                } else {
+                    responses.waitWritable(chunk, std::chrono::milliseconds(100));
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<network::ShmSegment> segment_;
+    std::atomic<bool> stop_{false};
+    std::thread thread_;
+};
+
+/**
+ * @brief 在fork出的子进程中启动共享内存模拟服务端
+ * @param child 输出参数，子进程号
+ * @param name 共享内存段名
+ * @return 是否启动成功
+ */
+inline bool startShmMockServerProcess(pid_t& child, const std::string& name) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return false;
+    }
+
+    child = fork();
+    if (child == 0) {
+        prctl(PR_SET_PDEATHSIG, SIGKILL);
+        close(fds[0]);
+        ShmMockRobotServer server(name);
+        char ready = 1;
+        ssize_t ignored = write(fds[1], &ready, sizeof(ready));
+        (void)ignored;
+        close(fds[1]);
+        pause();
+        _exit(0);
+    }
+
+    close(fds[1]);
+    char ready = 0;
+    ssize_t ignored = read(fds[0], &ready, sizeof(ready));
+    (void)ignored;
+    close(fds[0]);
+    return ready == 1;
+}
+
+/**
+ * @brief 停止 startShmMockServerProcess 启动的子进程并删除共享内存段
+ */
+inline void stopShmMockServerProcess(pid_t child, const std::string& name) {
+    stopMockServerProcess(child);
+    ::shm_unlink(("/" + name).c_str());
+}
+
+} // namespace benchmark
@@ -0,0 +1,113 @@
+/**
+ * @file shm_transport_benchmark.cpp
+ * @brief 共享内存传输与TCP回环、Unix域socket的对比
+ *
+ * 仿真测试中SDK与仿真器运行在同一主机上，每秒发送数千条运动控制命令。
+ * 对每种传输方式测量：
+ *  - 单线程串行 request1002_RunTimeState 的往返时延 p50/p99；
+ *  - 多线程并发 request2_ActionControl 的吞吐量，以及每条命令（请求+应答）消耗的本进程CPU时间。
+ *
+ * 模拟服务端运行在fork出的子进程中，CPU时间只统计SDK所在进程。
+ *
+ * 用法: shm_transport_benchmark [串行请求数] [并发线程数] [每线程命令数]
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+#include "shm_mock_robot_server.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+void runCase(const char* name, TransportBackend backend, const std::string& host, uint16_t port,
+             int serialCount, int threads, int perThread) {
+    SdkOptions options;
+    options.transport = backend;
+    RobotServerSdk sdk(options);
+    if (!sdk.connect(host, port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    // 预热
+    for (int i = 0; i < 200; ++i) {
+        sdk.request1002_RunTimeState();
+    }
+
+    // 串行往返时延
+    benchmark::LatencyStats stats;
+    for (int i = 0; i < serialCount; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        RealTimeStatus status = sdk.request1002_RunTimeState();
+        if (status.errorCode == ErrorCode_RealTimeStatus::SUCCESS) {
+            stats.add(std::chrono::steady_clock::now() - start);
+        }
+    }
+    stats.print(name);
+
+    // 并发运动控制命令的吞吐量和每条命令的CPU时间
+    std::atomic<int> succeeded{0};
+    double cpu_before = benchmark::processCpuMicroseconds();
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < perThread; ++i) {
+                if (sdk.request2_ActionControl(ActionCommand::STOP).errorCode == ErrorCode_MotionControl::SUCCESS) {
+                    ++succeeded;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double cpu = benchmark::processCpuMicroseconds() - cpu_before;
+
+    std::printf("%-24s 运动控制 并发%d线程: %d条 %.0f条/秒  CPU %.1fus/条\n",
+                name, threads, succeeded.load(), succeeded / seconds, cpu / std::max(succeeded.load(), 1));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int serialCount = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int threads = argc > 2 ? std::atoi(argv[2]) : 4;
+    int perThread = argc > 3 ? std::atoi(argv[3]) : 10000;
+
+    const std::string unixPath = "/tmp/robotserver_shm_benchmark.sock";
+    const std::string segmentName = "robotserver_shm_benchmark";
+
+    pid_t socketChild = 0;
+    uint16_t port = benchmark::startMockServerProcess(socketChild, unixPath);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+    pid_t shmChild = 0;
+    if (!benchmark::startShmMockServerProcess(shmChild, segmentName)) {
+        std::cerr << "启动共享内存模拟服务端失败" << std::endl;
+        benchmark::stopMockServerProcess(socketChild);
+        return 1;
+    }
+
+    std::cout << "TCP回环（端口 " << port << "） vs Unix域socket vs 共享内存（" << segmentName << "）" << std::endl;
+    runCase("EPOLL TCP", TransportBackend::EPOLL, "127.0.0.1", port, serialCount, threads, perThread);
+    runCase("EPOLL UNIX", TransportBackend::EPOLL, "unix://" + unixPath, 0, serialCount, threads, perThread);
+    runCase("SHARED_MEMORY", TransportBackend::SHARED_MEMORY, segmentName, 0, serialCount, threads, perThread);
+
+    benchmark::stopShmMockServerProcess(shmChild, segmentName);
+    benchmark::stopMockServerProcess(socketChild);
+    ::unlink(unixPath.c_str());
+    return 0;
+}
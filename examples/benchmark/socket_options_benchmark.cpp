@@ -0,0 +1,100 @@
+/**
+ * @file socket_options_benchmark.cpp
+ * @brief socket选项对速度控制命令往返时延的影响
+ *
+ * 分别以未调优（开启Nagle、无keepalive）和调优（TCP_NODELAY、加大缓冲区、keepalive、SO_BUSY_POLL）
+ * 的socket选项连接模拟服务端，测量 request2_SpeedControl 的往返时延 p50/p99。
+ * 后台线程持续发送1002查询，模拟实际使用中速度命令与状态查询交替的情况，
+ * 此时Nagle算法会让速度命令等待前一个查询帧被确认。
+ *
+ * SDK将速度命令限制在5Hz，因此每个样本间隔200ms，默认每组100个样本约需20秒。
+ *
+ * 用法: socket_options_benchmark [样本数] [主机 端口]
+ *       不指定主机时使用内置的模拟服务端
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+// 速度命令的最小间隔（SDK限制为5Hz）
+constexpr auto SPEED_COMMAND_INTERVAL = std::chrono::milliseconds(210);
+
+void runCase(const char* name, const SocketOptions& socketOptions, const std::string& host, uint16_t port, int samples) {
+    SdkOptions options;
+    options.socket = socketOptions;
+    RobotServerSdk sdk(options);
+    if (!sdk.connect(host, port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    // 后台状态查询
+    std::atomic<bool> running{true};
+    std::thread background([&]() {
+        while (running) {
+            sdk.request1002_RunTimeState();
+        }
+    });
+
+    benchmark::LatencyStats stats;
+    std::this_thread::sleep_for(SPEED_COMMAND_INTERVAL);
+    for (int i = 0; i < samples; ++i) {
+        auto next = std::chrono::steady_clock::now() + SPEED_COMMAND_INTERVAL;
+        auto start = std::chrono::steady_clock::now();
+        MotionControlResult result = sdk.request2_SpeedControl(SpeedCommand::FORWARD, 0.1f);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        if (result.errorCode == ErrorCode_MotionControl::SUCCESS) {
+            stats.add(elapsed);
+        }
+        std::this_thread::sleep_until(next);
+    }
+
+    running = false;
+    background.join();
+    stats.print(name);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int samples = argc > 1 ? std::atoi(argv[1]) : 100;
+
+    std::unique_ptr<benchmark::MockRobotServer> server;
+    std::string host = "127.0.0.1";
+    uint16_t port = 0;
+    if (argc > 3) {
+        host = argv[2];
+        port = static_cast<uint16_t>(std::atoi(argv[3]));
+    } else {
+        server = std::make_unique<benchmark::MockRobotServer>();
+        port = server->port();
+    }
+
+    std::cout << "request2_SpeedControl 往返时延（" << host << ":" << port << "，后台1002查询）" << std::endl;
+
+    SocketOptions untuned;
+    untuned.noDelay = false;
+    untuned.keepAlive = false;
+    runCase("未调优(Nagle)", untuned, host, port, samples);
+
+    SocketOptions tuned;
+    tuned.noDelay = true;
+    tuned.sendBufferSize = 256 * 1024;
+    tuned.receiveBufferSize = 256 * 1024;
+    tuned.busyPollMicroseconds = 50;
+    runCase("调优(NODELAY+BUSY_POLL)", tuned, host, port, samples);
+
+    return 0;
+}
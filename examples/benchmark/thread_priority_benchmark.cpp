@@ -0,0 +1,131 @@
+/**
+ * @file thread_priority_benchmark.cpp
+ * @brief CPU满载时IO线程默认调度与实时调度（SCHED_RR）的往返时延对比
+ *
+ * 本进程启动若干个持续占用CPU的线程模拟感知等计算负载，主线程周期性同步请求 request1002_RunTimeState，
+ * 测量其往返时延分布，并输出SDK报告的线程设置结果。
+ * 实时调度一项同时把调用线程设为相同的实时优先级（控制循环通常也是实时线程）。
+ * 模拟服务端代表另一台设备，两项中都以实时优先级运行，不受本机负载影响。
+ *
+ * 设置实时调度需要 root 或 CAP_SYS_NICE，没有权限时SDK报告设置失败，两项结果相近。
+ *
+ * 用法: thread_priority_benchmark [请求数] [负载线程数] [实时优先级]
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+const char* resultName(ThreadSettingResult result) {
+    switch (result) {
+    case ThreadSettingResult::APPLIED: return "生效";
+    case ThreadSettingResult::FAILED: return "失败";
+    default: return "-";
+    }
+}
+
+// 把子进程的所有线程设为实时调度
+void setProcessRealtime(pid_t pid, int priority) {
+    std::string path = "/proc/" + std::to_string(pid) + "/task";
+    DIR* dir = opendir(path.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    sched_param param{};
+    param.sched_priority = priority;
+    while (dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') {
+            sched_setscheduler(std::atoi(entry->d_name), SCHED_RR, &param);
+        }
+    }
+    closedir(dir);
+}
+
+void runCase(const char* name, bool realtime, int priority, uint16_t port, int count) {
+    SdkOptions options;
+    if (realtime) {
+        options.threads.policy = ThreadSchedulingPolicy::ROUND_ROBIN;
+        options.threads.priority = priority;
+    }
+    RobotServerSdk sdk(options);
+    if (!sdk.connect("127.0.0.1", port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    sched_param param{};
+    param.sched_priority = realtime ? priority : 0;
+    pthread_setschedparam(pthread_self(), realtime ? SCHED_RR : SCHED_OTHER, &param);
+
+    benchmark::LatencyStats stats;
+    for (int i = 0; i < count; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        if (sdk.request1002_RunTimeState().errorCode == ErrorCode_RealTimeStatus::SUCCESS) {
+            stats.add(std::chrono::steady_clock::now() - start);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    param.sched_priority = 0;
+    pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+    stats.print(name);
+    for (const ThreadStatus& status : sdk.getThreadStatus()) {
+        std::printf("%-24s 线程 %-15s 线程名%s CPU亲和性%s 调度策略%s %s\n", name, status.name.c_str(),
+                    resultName(status.nameResult), resultName(status.affinityResult),
+                    resultName(status.schedulingResult), status.error.c_str());
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int loadThreads = argc > 2 ? std::atoi(argv[2]) : static_cast<int>(std::max(1u, std::thread::hardware_concurrency())) * 2;
+    int priority = argc > 3 ? std::atoi(argv[3]) : 10;
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+    setProcessRealtime(child, priority);
+
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> load;
+    for (int i = 0; i < loadThreads; ++i) {
+        load.emplace_back([&stop]() {
+            volatile uint64_t sink = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                sink = sink + 1;
+            }
+        });
+    }
+
+    std::cout << loadThreads << "个负载线程占满CPU时 request1002 的往返时延（模拟服务端端口 " << port << "）" << std::endl;
+    runCase("默认调度", false, priority, port, count);
+    runCase("实时调度(SCHED_RR)", true, priority, port, count);
+
+    stop = true;
+    for (auto& thread : load) {
+        thread.join();
+    }
+    benchmark::stopMockServerProcess(child);
+    return 0;
+}
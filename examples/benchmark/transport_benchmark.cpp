@@ -0,0 +1,102 @@
+/**
+ * @file transport_benchmark.cpp
+ * @brief 传输层实现对比：Boost.Asio、原生 epoll 与 io_uring
+ *
+ * 对每种传输层测量：
+ *  - 单线程串行 request1002_RunTimeState 的往返时延 p50/p99；
+ *  - 多线程并发请求的吞吐量，以及每条消息（请求+响应）消耗的本进程CPU时间。
+ *
+ * 模拟服务端运行在fork出的子进程中，CPU时间只统计SDK所在进程。
+ *
+ * 用法: transport_benchmark [串行请求数] [并发线程数] [每线程请求数]
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+void runCase(const char* name, TransportBackend backend, uint16_t port, int serialCount, int threads, int perThread) {
+    SdkOptions options;
+    options.transport = backend;
+    RobotServerSdk sdk(options);
+    if (!sdk.connect("127.0.0.1", port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    // 预热
+    for (int i = 0; i < 200; ++i) {
+        sdk.request1002_RunTimeState();
+    }
+
+    // 串行往返时延
+    benchmark::LatencyStats stats;
+    for (int i = 0; i < serialCount; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        RealTimeStatus status = sdk.request1002_RunTimeState();
+        if (status.errorCode == ErrorCode_RealTimeStatus::SUCCESS) {
+            stats.add(std::chrono::steady_clock::now() - start);
+        }
+    }
+    stats.print(name);
+
+    // 并发吞吐量和每条消息的CPU时间
+    std::atomic<int> succeeded{0};
+    double cpu_before = benchmark::processCpuMicroseconds();
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < perThread; ++i) {
+                if (sdk.request1002_RunTimeState().errorCode == ErrorCode_RealTimeStatus::SUCCESS) {
+                    ++succeeded;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double cpu = benchmark::processCpuMicroseconds() - cpu_before;
+
+    ConnectionStatistics connectionStats = sdk.getConnectionStatistics();
+    double framesPerWrite = connectionStats.writeOperations
+        ? static_cast<double>(connectionStats.framesSent) / connectionStats.writeOperations : 0.0;
+
+    std::printf("%-24s 并发%d线程: %d条 %.0f条/秒  CPU %.1fus/条  平均每次写聚合 %.2f帧\n",
+                name, threads, succeeded.load(), succeeded / seconds, cpu / std::max(succeeded.load(), 1), framesPerWrite);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int serialCount = argc > 1 ? std::atoi(argv[1]) : 5000;
+    int threads = argc > 2 ? std::atoi(argv[2]) : 8;
+    int perThread = argc > 3 ? std::atoi(argv[3]) : 5000;
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+
+    std::cout << "request1002_RunTimeState 传输层对比（模拟服务端端口 " << port << "）" << std::endl;
+    runCase("ASIO", TransportBackend::ASIO, port, serialCount, threads, perThread);
+    runCase("EPOLL", TransportBackend::EPOLL, port, serialCount, threads, perThread);
+    runCase("IO_URING", TransportBackend::IO_URING, port, serialCount, threads, perThread);
+
+    benchmark::stopMockServerProcess(child);
+    return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file unix_socket_benchmark.cpp
+ * @brief Unix域socket与TCP回环的往返时延对比
+ *
+ * SDK与RobotServer部署在同一设备上时可以使用 unix:///path 地址，绕过TCP协议栈。
+ * 对每种传输层实现分别通过TCP回环和Unix域socket连接同一个模拟服务端，
+ * 测量单线程串行 request1002_RunTimeState 的往返时延 p50/p99。
+ *
+ * 模拟服务端运行在fork出的子进程中。
+ *
+ * 用法: unix_socket_benchmark [请求数] [socket路径]
+ */
+
+#include <robotserver_sdk.h>
+#include "benchmark_util.hpp"
+#include "mock_robot_server.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace robotserver_sdk;
+
+namespace {
+
+void runCase(const std::string& name, TransportBackend backend, const std::string& host, uint16_t port, int count) {
+    SdkOptions options;
+    options.transport = backend;
+    RobotServerSdk sdk(options);
+    if (!sdk.connect(host, port)) {
+        std::cerr << name << ": 连接失败" << std::endl;
+        return;
+    }
+
+    // 预热
+    for (int i = 0; i < 200; ++i) {
+        sdk.request1002_RunTimeState();
+    }
+
+    benchmark::LatencyStats stats;
+    for (int i = 0; i < count; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        RealTimeStatus status = sdk.request1002_RunTimeState();
+        if (status.errorCode == ErrorCode_RealTimeStatus::SUCCESS) {
+            stats.add(std::chrono::steady_clock::now() - start);
+        }
+    }
+    stats.print(name.c_str());
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 10000;
+    std::string path = argc > 2 ? argv[2] : "/tmp/robotserver_benchmark.sock";
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child, path);
+    if (port == 0) {
+        std::cerr << "启动模拟服务端失败" << std::endl;
+        return 1;
+    }
+
+    std::cout << "request1002_RunTimeState 往返时延：TCP回环（端口 " << port << "） vs Unix域socket（" << path << "）"
+              << std::endl;
+    const std::pair<const char*, TransportBackend> backends[] = {
+        {"ASIO", TransportBackend::ASIO},
+        {"EPOLL", TransportBackend::EPOLL},
+        {"IO_URING", TransportBackend::IO_URING},
+    };
+    for (const auto& backend : backends) {
+        runCase(std::string(backend.first) + " TCP", backend.second, "127.0.0.1", port, count);
+        runCase(std::string(backend.first) + " UNIX", backend.second, "unix://" + path, 0, count);
+    }
+
+    benchmark::stopMockServerProcess(child);
+    ::unlink(path.c_str());
+    return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file xml_parse_benchmark.cpp
+ * @brief 响应消息体的解码耗时：通用XML解析（rapidxml）与专用扫描器对比
+ *
+ * 对设备返回的各类响应（1002/1003/1007/2102/运动控制）反复解码为消息对象：
+ * 1. rapidxml：复用的XML文档构建DOM后转换为字段视图（扫描器不接受的消息体走这条路径）；
+ * 2. 专用扫描器：Serializer::deserializeFrame，按固定布局原地扫描消息体。
+ * 直接调用SDK内部的协议层，不经过网络。
+ *
+ * 用法: xml_parse_benchmark [每类响应的解码次数]
+ */
+
+#include "protocol/messages.hpp"
+#include "protocol/patrol_scanner.hpp"
+#include "protocol/serializer.hpp"
+#include "protocol/xml_document.hpp"
+#include "recorded_responses.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+// 通用XML解析路径
+std::unique_ptr<protocol::IMessage> decodeWithRapidXml(protocol::XmlDocument& document, protocol::MessageType type,
+                                                       const std::string& body) {
+    protocol::PatrolFields fields;
+    const rapidxml::xml_node<>* root = document.parse(body.data(), body.size());
+    if (!root || !protocol::readPatrolFields(*root, fields)) {
+        return nullptr;
+    }
+    auto message = protocol::createMessage(type);
+    if (!message || !message->deserializeFields(fields)) {
+        return nullptr;
+    }
+    return message;
+}
+
+template <typename Decode>
+double measure(int count, Decode decode) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        if (!decode()) {
+            return -1.0;
+        }
+    }
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / count;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 200000;
+
+    protocol::Serializer serializer;
+    protocol::XmlDocument document;
+    protocol::PatrolFields fields;
+
+    std::printf("%-16s %8s %14s %14s %8s\n", "响应", "消息体", "rapidxml", "专用扫描器", "加速比");
+    for (const benchmark::RecordedResponse& response : benchmark::recordedResponses()) {
+        if (!protocol::scanPatrolDevice(response.body.data(), response.body.size(), fields)) {
+            std::fprintf(stderr, "%s: 专用扫描器不接受该消息体\n", response.name);
+            return 1;
+        }
+        protocol::ProtocolHeader header(static_cast<uint16_t>(response.body.size()), 1);
+
+        double dom = measure(count, [&]() { return decodeWithRapidXml(document, response.type, response.body) != nullptr; });
+        double scan = measure(count, [&]() {
+            return serializer.deserializeFrame(header, response.body.data(), response.body.size()) != nullptr;
+        });
+        if (dom < 0 || scan < 0) {
+            std::fprintf(stderr, "%s: 解码失败\n", response.name);
+            return 1;
+        }
+        std::printf("%-16s %6zuB %12.2fus %12.2fus %7.1fx\n", response.name, response.body.size(), dom, scan, dom / scan);
+    }
+    return 0;
+}
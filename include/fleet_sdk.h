@@ -0,0 +1,167 @@
+#pragma once
+
+#include "types.h"
+#include "sdk_runtime.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace robotserver_sdk {
+
+// 前向声明，隐藏实现细节
+class RobotServerSdkImpl;
+
+/**
+ * @brief 机器狗连接地址
+ */
+struct RobotEndpoint {
+    std::string robotId;  ///< 机器狗ID
+    std::string host;     ///< 主机地址或 unix:///path
+    uint16_t port = 0;    ///< 端口号
+};
+
+/**
+ * @brief 多机器狗连接管理器
+ *
+ * 按机器狗ID管理多个连接，所有连接共享同一个 SdkRuntime 的IO线程。
+ * requestAll* 批量操作先向所有机器狗发出请求，再用同一个截止时间统一等待，
+ * 整体耗时约为一次往返时间，而不是逐台同步请求的 N 倍。
+ * 传入IO线程数为0的运行时时，由调用方调用 SdkRuntime::poll() 驱动所有连接。
+ */
+class FleetSdk {
+public:
+    /**
+     * @brief 构造函数
+     * @param options SDK配置选项；options.runtime 为空时按 options.busyPoll / options.threads 创建线程数等于CPU核数的共享运行时
+     */
+    explicit FleetSdk(const SdkOptions& options = SdkOptions());
+
+    /**
+     * @brief 析构函数，断开所有连接
+     */
+    ~FleetSdk();
+
+    /**
+     * @brief 禁用拷贝构造函数
+     */
+    FleetSdk(const FleetSdk&) = delete;
+
+    /**
+     * @brief 禁用赋值操作符
+     */
+    FleetSdk& operator=(const FleetSdk&) = delete;
+
+    /**
+     * @brief 添加机器狗并连接
+     * @param robotId 机器狗ID
+     * @param host 主机地址或 unix:///path
+     * @param port 端口号
+     * @return 连接是否成功；ID已存在时返回false
+     *
+     * 连接失败的机器狗仍然保留在列表中，其批量请求结果为未连接错误码。
+     */
+    bool addRobot(const std::string& robotId, const std::string& host, uint16_t port);
+
+    /**
+     * @brief 批量添加机器狗并并行连接
+     * @param robots 机器狗连接地址列表
+     * @param maxConcurrentConnects 同时进行的连接尝试数量上限
+     * @return 机器狗ID到连接结果的映射；ID已存在的机器狗结果为false且不会被替换
+     *
+     * 所有连接在IO线程中异步进行，整体耗时约为一个连接超时时间，而不是逐台连接的 N 倍。
+     * 调用线程等待全部连接完成，不能在IO线程（如 INLINE 方式的用户回调）中调用，否则所有连接结果为false。
+     */
+    std::map<std::string, bool> addRobots(const std::vector<RobotEndpoint>& robots, std::size_t maxConcurrentConnects = 32);
+
+    /**
+     * @brief 并行连接所有未连接的机器狗（如启动或断线后）
+     * @param maxConcurrentConnects 同时进行的连接尝试数量上限
+     * @return 机器狗ID到连接结果的映射，已连接的机器狗结果为true
+     *
+     * 与 addRobots() 相同，不能在IO线程中调用。
+     */
+    std::map<std::string, bool> connectAll(std::size_t maxConcurrentConnects = 32);
+
+    /**
+     * @brief 断开并移除机器狗
+     * @param robotId 机器狗ID
+     * @return 是否存在该机器狗
+     */
+    bool removeRobot(const std::string& robotId);
+
+    /**
+     * @brief 获取所有机器狗ID
+     * @return 机器狗ID列表
+     */
+    std::vector<std::string> robotIds() const;
+
+    /**
+     * @brief 检查指定机器狗是否已连接
+     * @param robotId 机器狗ID
+     * @return 是否已连接；ID不存在时返回false
+     */
+    bool isConnected(const std::string& robotId) const;
+
+    /**
+     * @brief request1002 并发获取所有机器狗的实时状态
+     * @return 机器狗ID到实时状态的映射；截止时间内未响应的为超时错误码
+     */
+    std::map<std::string, RealTimeStatus> requestAll1002_RunTimeState();
+
+    /**
+     * @brief request1007 并发查询所有机器狗的导航任务状态
+     * @return 机器狗ID到任务状态的映射
+     */
+    std::map<std::string, TaskStatusResult> requestAll1007_NavTaskState();
+
+    /**
+     * @brief request2102 并发获取所有机器狗的RTK融合数据
+     * @return 机器狗ID到RTK融合数据的映射
+     */
+    std::map<std::string, RTKFusionData> requestAll2102_RTKFusionData();
+
+    /**
+     * @brief request2103 并发获取所有机器狗的RTK原始数据
+     * @return 机器狗ID到RTK原始数据的映射
+     */
+    std::map<std::string, RTKRawData> requestAll2103_RTKRawData();
+
+    /**
+     * @brief request2_ActionControl 向所有机器狗并发下发动作控制指令
+     * @param cmd 动作命令类型
+     * @return 机器狗ID到操作结果的映射
+     */
+    std::map<std::string, MotionControlResult> requestAll2_ActionControl(ActionCommand cmd);
+
+private:
+    /**
+     * @brief 机器狗条目
+     */
+    struct RobotEntry {
+        std::string host;                          ///< 主机地址
+        uint16_t port = 0;                         ///< 端口号
+        std::shared_ptr<RobotServerSdkImpl> sdk;   ///< 连接
+    };
+
+    /**
+     * @brief 获取当前所有机器狗的快照，批量操作期间不持有锁
+     */
+    std::vector<std::pair<std::string, std::shared_ptr<RobotServerSdkImpl>>> snapshot() const;
+
+    /**
+     * @brief 以有限并发度并行连接
+     * @param robots 待连接的机器狗
+     * @param maxConcurrentConnects 同时进行的连接尝试数量上限
+     * @return 机器狗ID到连接结果的映射
+     */
+    std::map<std::string, bool> parallelConnect(const std::vector<std::pair<std::string, RobotEntry>>& robots,
+                                                std::size_t maxConcurrentConnects);
+
+    SdkOptions options_;
+    mutable std::mutex robots_mutex_;
+    std::map<std::string, RobotEntry> robots_;
+};
+
+} // namespace robotserver_sdk
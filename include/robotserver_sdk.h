@@ -1,6 +1,7 @@
 #pragma once
 
 #include "types.h"
+#include "sdk_runtime.h"
 #include <memory>
 #include <string>
 #include <future>
@@ -41,14 +42,32 @@ public:
 
     /**
      * @brief 连接到机器狗控制系统
-     * @param host 主机地址
+     * @param host 主机地址，或 unix:///path 形式的Unix域socket路径（与RobotServer部署在同一设备上时使用，忽略端口号）；
+     *             使用 TransportBackend::SHARED_MEMORY 时为仿真器创建的共享内存段名
      * @param port 端口号
      * @return 连接是否成功
      */
     bool connect(const std::string& host, uint16_t port);
 
     /**
-     * @brief 断开与机器狗控制系统的连接
+     * @brief 基于回调的异步连接，立即返回
+     * @param host 主机地址或 unix:///path
+     * @param port 端口号
+     * @param callback 连接完成（成功、失败或超时）后调用
+     * @note 回调函数的执行线程由 SdkOptions::callbacks 决定，默认在IO线程中调用，不应执行长时间操作
+     */
+    void connectAsync(const std::string& host, uint16_t port, ConnectResultCallback callback);
+
+    /**
+     * @brief 基于future的异步连接，立即返回
+     * @param host 主机地址或 unix:///path
+     * @param port 端口号
+     * @return 连接完成后就绪的future，值为是否连接成功
+     */
+    std::future<bool> connectAsync(const std::string& host, uint16_t port);
+
+    /**
+     * @brief 断开与机器狗控制系统的连接，同时取消正在进行的自动重连
      */
     void disconnect();
 
@@ -58,6 +77,73 @@ public:
      */
     bool isConnected() const;
 
+    /**
+     * @brief 获取连接统计信息（发送队列深度、每次写操作聚合的帧数和字节数、往返时延等），启用独立控制连接时为两条连接合计
+     * @return 统计信息快照
+     */
+    ConnectionStatistics getConnectionStatistics() const;
+
+    /**
+     * @brief 获取一个连接通道的统计信息，包括该通道上请求的往返时延
+     * @param channel 连接通道；未启用 SdkOptions::dedicatedControlConnection 时两个通道是同一条连接
+     * @return 统计信息快照
+     */
+    ConnectionStatistics getConnectionStatistics(ConnectionChannel channel) const;
+
+    /**
+     * @brief 获取用户回调统计（排队时延、执行时长），用于发现阻塞回调线程的慢回调
+     * @return 统计信息快照
+     */
+    CallbackStatistics getCallbackStatistics() const;
+
+    /**
+     * @brief 获取SDK线程的设置结果（线程名、CPU亲和性、调度策略是否生效），见 SdkOptions::threads
+     * @return 运行时已创建线程的结果；使用共享运行时时为该运行时的所有线程
+     */
+    std::vector<ThreadStatus> getThreadStatus() const;
+
+    /**
+     * @brief 获取完成队列的eventfd，SdkOptions::callbacks 为 EVENT_FD 方式时，有回调就绪即可读
+     * @return 非阻塞的eventfd，由运行时持有，不要关闭；使用共享运行时时所有SDK实例返回同一个描述符
+     */
+    int completionEventFd();
+
+    /**
+     * @brief 在调用线程中执行完成队列中所有就绪的回调（导航结果、连接状态变化、异步连接结果）
+     * @return 执行的回调数；使用共享运行时时包括其他SDK实例的回调
+     */
+    std::size_t drainCompletions();
+
+    /**
+     * @brief 在调用线程中执行就绪的IO处理函数（收发、连接完成、重连定时器、SDK回调），不会阻塞超过 timeout
+     * @param timeout 没有就绪的处理函数时最多等待的时间，0表示不等待
+     * @return 执行的处理函数数量；运行时有IO线程时不执行任何处理函数，返回0
+     * @note 仅在 SdkOptions::callerDrivenIo 或使用IO线程数为0的运行时时有效；
+     *       nativeHandle() 可读时调用即可及时处理响应，此外应周期性调用以推进发送和定时器；
+     *       异步发出的请求在下一次 poll() 时写出。不能在SDK回调中调用。
+     */
+    std::size_t poll(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * @brief 获取连接的socket文件描述符，调用方驱动IO时将其加入自己的 epoll/select 事件循环（只监听可读）
+     * @param channel 连接通道；未启用 SdkOptions::dedicatedControlConnection 时两个通道是同一条连接
+     * @return 文件描述符，未连接或使用 EPOLL/IO_URING/SHARED_MEMORY 传输时返回-1；重连后会变化
+     */
+    int nativeHandle(ConnectionChannel channel = ConnectionChannel::CONTROL) const;
+
+    /**
+     * @brief 获取当前连接状态
+     * @return 连接状态
+     */
+    ConnectionState getConnectionState() const;
+
+    /**
+     * @brief 设置连接状态变化回调（连接、断开、开始自动重连、重连成功等）
+     * @param callback 状态变化回调函数，传入空函数取消回调
+     * @note 回调函数的执行线程由 SdkOptions::callbacks 决定，默认在IO线程中调用，不应执行长时间操作
+     */
+    void setConnectionStateCallback(ConnectionStateCallback callback);
+
     /**
      * @brief request1002 获取机器狗的实时状态
      * @return 实时状态信息
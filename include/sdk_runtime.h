@@ -0,0 +1,99 @@
+#pragma once
+
+#include "types.h"
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace robotserver_sdk {
+
+// 前向声明，隐藏实现细节
+class SdkRuntimeImpl;
+
+/**
+ * @brief SDK运行时，持有IO线程池
+ *
+ * 默认情况下每个 RobotServerSdk 创建自己的运行时（一个IO线程）。
+ * 管理大量机器狗时，可以创建一个共享的运行时并通过 SdkOptions::runtime 传给每个SDK实例，
+ * 所有连接共享同一组IO线程（每个连接使用独立的strand串行处理），
+ * 线程数量由调用方按CPU核数决定，而不是随机器狗数量增长。
+ *
+ * 运行时由 std::shared_ptr 持有，所有使用它的SDK实例析构后才会停止IO线程。
+ *
+ * IO线程数为0时运行时不创建任何线程（调用方驱动），收发、连接和重连定时器
+ * 只在调用方调用 poll() 时推进，适合把SDK并入已有的 epoll/select 事件循环。
+ * 同步接口（connect、requestXXX）在等待期间自行驱动，可直接在事件循环线程中调用。
+ */
+class SdkRuntime {
+public:
+    /**
+     * @brief 构造函数，立即启动IO线程
+     * @param ioThreadCount IO线程数量，0表示不创建线程，由调用方调用 poll() 驱动
+     */
+    explicit SdkRuntime(std::size_t ioThreadCount = 1);
+
+    /**
+     * @brief 构造函数，立即启动IO线程
+     * @param ioThreadCount IO线程数量，0表示不创建线程，由调用方调用 poll() 驱动
+     * @param busyPoll IO线程忙轮询配置，同时用于 EPOLL/IO_URING 传输的事件循环线程
+     * @param threads 运行时创建的所有线程的CPU亲和性、调度策略和线程名
+     */
+    SdkRuntime(std::size_t ioThreadCount, const BusyPollOptions& busyPoll, const ThreadOptions& threads = ThreadOptions());
+
+    /**
+     * @brief 析构函数，停止并等待所有IO线程
+     */
+    ~SdkRuntime();
+
+    /**
+     * @brief 禁用拷贝构造函数
+     */
+    SdkRuntime(const SdkRuntime&) = delete;
+
+    /**
+     * @brief 禁用赋值操作符
+     */
+    SdkRuntime& operator=(const SdkRuntime&) = delete;
+
+    /**
+     * @brief 获取IO线程数量
+     * @return IO线程数量
+     */
+    std::size_t ioThreadCount() const;
+
+    /**
+     * @brief 获取运行时已创建线程的设置结果（线程名、CPU亲和性、调度策略是否生效）
+     * @return 按线程启动顺序排列的结果；事件循环线程和回调线程在第一次使用时创建
+     */
+    std::vector<ThreadStatus> threadStatus() const;
+
+    /**
+     * @brief 获取完成队列的eventfd，队列中有待执行的回调时可读
+     * @return 非阻塞的eventfd，加入调用方的 epoll/libuv 事件循环（监听可读），由运行时持有，不要关闭；创建失败时返回-1
+     * @note 仅用于 CallbackExecution::EVENT_FD 方式，同一运行时的所有SDK实例共享
+     */
+    int completionEventFd();
+
+    /**
+     * @brief 在调用线程中执行完成队列中的所有回调，并清除eventfd的可读状态
+     * @return 执行的回调数
+     * @note 两次调用之间无论有多少回调就绪，eventfd 只被写一次；不能在SDK回调中调用
+     */
+    std::size_t drainCompletions();
+
+    /**
+     * @brief 在调用线程中执行就绪的IO处理函数（仅IO线程数为0时有效）
+     * @param timeout 没有就绪的处理函数时最多等待的时间，0表示不等待
+     * @return 执行的处理函数数量；运行时有IO线程时不执行任何处理函数，返回0
+     * @note 不能在SDK回调中调用
+     */
+    std::size_t poll(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+private:
+    friend class RobotServerSdkImpl;
+
+    std::unique_ptr<SdkRuntimeImpl> impl_; ///< PIMPL实现
+};
+
+} // namespace robotserver_sdk
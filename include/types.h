@@ -8,6 +8,8 @@
 #include <vector>
 namespace robotserver_sdk {
 
+class SdkRuntime;
+
 /**
  * @brief 1003 导航任务响应ErrorCode枚举
  */
@@ -18,7 +20,8 @@ enum class ErrorCode_Navigation {
 
     INVALID_PARAM = 3,///< 无效参数
     NOT_CONNECTED = 4,///< 未连接
-    UNKNOWN_ERROR = 5 ///< 未知错误
+    UNKNOWN_ERROR = 5,///< 未知错误
+    DROPPED = 6       ///< 发送队列已满，请求未发出
 };
 
 /**
@@ -77,7 +80,8 @@ enum class ErrorCode_QueryStatus {
     INVALID_RESPONSE = 2,   ///< 无效响应
     TIMEOUT = 3,            ///< 超时
     NOT_CONNECTED = 4,      ///< 未连接
-    UNKNOWN_ERROR = 5       ///< 未知错误
+    UNKNOWN_ERROR = 5,      ///< 未知错误
+    DROPPED = 6             ///< 链路拥塞，请求未发出
 };
 
 /**
@@ -98,7 +102,8 @@ enum class ErrorCode_RealTimeStatus {
     INVALID_RESPONSE = 1,   ///< 无效响应
     TIMEOUT = 2,            ///< 超时
     NOT_CONNECTED = 3,      ///< 未连接
-    UNKNOWN_ERROR = 4       ///< 未知错误
+    UNKNOWN_ERROR = 4,      ///< 未知错误
+    DROPPED = 5             ///< 链路拥塞，请求未发出
 };
 
 /**
@@ -110,7 +115,8 @@ enum class ErrorCode_RTKFusion {
     INVALID_RESPONSE = 1,   ///< 无效响应
     TIMEOUT = 2,            ///< 超时
     NOT_CONNECTED = 3,      ///< 未连接
-    UNKNOWN_ERROR = 4       ///< 未知错误
+    UNKNOWN_ERROR = 4,      ///< 未知错误
+    DROPPED = 5             ///< 链路拥塞，请求未发出
 };
 
 /**
@@ -122,7 +128,8 @@ enum class ErrorCode_RTKRaw {
     INVALID_RESPONSE = 1,   ///< 无效响应
     TIMEOUT = 2,            ///< 超时
     NOT_CONNECTED = 3,      ///< 未连接
-    UNKNOWN_ERROR = 4       ///< 未知错误
+    UNKNOWN_ERROR = 4,      ///< 未知错误
+    DROPPED = 5             ///< 链路拥塞，请求未发出
 };
 
 /**
@@ -180,7 +187,8 @@ enum class ErrorCode_MotionControl {
     NOT_CONNECTED = 2,      ///< 未连接
     TIMEOUT = 3,            ///< 超时
     TOO_FREQUENT = 4,       ///< 命令发送过于频繁
-    UNKNOWN_ERROR = 5       ///< 未知错误
+    UNKNOWN_ERROR = 5,      ///< 未知错误
+    DROPPED = 6             ///< 被更新的速度命令取代或发送队列已满，命令未发出
 };
 
 /**
@@ -252,6 +260,7 @@ struct RealTimeStatus {
     int chargeState = 0;                ///< 充电状态
     int controlMode = 0;                ///< 控制模式
     int mapUpdateState = 0;             ///< 地图更新状态
+    int invalidFieldCount = 0;          ///< 响应中无法解析（不是有效数值或超出范围）而保留默认值的字段数
 
     ErrorCode_RealTimeStatus errorCode = ErrorCode_RealTimeStatus::SUCCESS; ///< 错误码
 };
@@ -273,12 +282,243 @@ struct TaskStatusResult {
     ErrorCode_QueryStatus errorCode = ErrorCode_QueryStatus::COMPLETED; ///< 错误码:   0:成功; 1:执行中; 2:失败
 };
 
+/**
+ * @brief 连接状态枚举
+ */
+enum class ConnectionState {
+    DISCONNECTED = 0,   ///< 未连接
+    CONNECTING = 1,     ///< 连接中
+    CONNECTED = 2,      ///< 已连接
+    RECONNECTING = 3    ///< 连接丢失，正在自动重连
+};
+
+/**
+ * @brief 连接丢失时对未完成请求的处理策略
+ */
+enum class PendingRequestPolicy {
+    FAIL = 0,   ///< 立即以未连接错误码结束所有未完成请求
+    REPLAY = 1  ///< 重连成功后重发幂等请求（1002/1004/1007/2102/2103）；运动控制和导航任务仍立即失败
+};
+
+/**
+ * @brief 自动重连配置
+ *
+ * 第 n 次重连前等待 min(maxDelay, initialDelay * backoffMultiplier^n)，
+ * 并在此基础上随机浮动 ±jitter 比例，避免大量机器狗同时重连。
+ */
+struct ReconnectOptions {
+    bool enabled = false;                                           ///< 是否启用自动重连
+    std::chrono::milliseconds initialDelay{100};                    ///< 首次重连前的等待时间
+    std::chrono::milliseconds maxDelay{5000};                       ///< 重连等待时间上限
+    double backoffMultiplier = 2.0;                                 ///< 退避倍数
+    double jitter = 0.2;                                            ///< 随机浮动比例（0~1）
+    int maxAttempts = 0;                                            ///< 最大连续重连次数，0表示不限
+    PendingRequestPolicy pendingRequestPolicy = PendingRequestPolicy::FAIL; ///< 未完成请求的处理策略
+};
+
+/**
+ * @brief 发送队列中一类消息的排队策略
+ */
+enum class SendQueuePolicy {
+    ENQUEUE = 0,     ///< 排队等待发送，队列满时丢弃新帧
+    LATEST_WINS = 1, ///< 替换队列中尚未发出的同类旧帧（速度命令按运动方向区分），队列满时丢弃新帧
+    FAIL_FAST = 2    ///< 链路拥塞（排队帧数达到 congestionThreshold）时直接丢弃新帧
+};
+
+/**
+ * @brief 每连接发送队列的容量和排队策略
+ *
+ * 链路阻塞时发送队列不再无限增长：被丢弃或被取代的请求立即以 DROPPED 错误码结束，
+ * 不必等到请求超时，链路恢复后也不会集中发出过时的速度命令。
+ * 帧数包括正在写出的批次，但只有尚未开始写出的帧会被取代。
+ * 默认所有消息按 ENQUEUE 排队，与不设上限时的发送顺序相同，只是队列满时丢弃新帧；
+ * 遥控等对时延敏感的场景可将 speedCommands 设为 LATEST_WINS、queries 设为 FAIL_FAST。
+ * SHARED_MEMORY 传输直接写入共享内存环，没有发送队列，不使用此配置。
+ */
+struct SendQueueOptions {
+    std::size_t maxQueuedFrames = 256;    ///< 已接受但尚未写完的帧数上限，0表示不限
+    std::size_t congestionThreshold = 32; ///< 尚未写完的帧数达到该值时视为链路拥塞
+    SendQueuePolicy speedCommands = SendQueuePolicy::ENQUEUE;  ///< 速度命令（request2_SpeedControl）
+    SendQueuePolicy motionCommands = SendQueuePolicy::ENQUEUE; ///< 其他运动控制命令（动作、急停、配置）
+    SendQueuePolicy navigation = SendQueuePolicy::ENQUEUE;     ///< 导航任务（1003/1004）
+    SendQueuePolicy queries = SendQueuePolicy::ENQUEUE;        ///< 状态查询（1002/1007/2102/2103）
+    bool prioritizeSafetyCommands = true; ///< 软急停和停止命令走优先通道：排在所有尚未写出的帧之前，不受队列上限限制
+};
+
+/**
+ * @brief socket选项，连接建立后立即设置
+ *
+ * 数值为0表示保持系统默认值；keepAlive 默认不开启，此时不设置 SO_KEEPALIVE 和三项探测参数。
+ * 设置失败只记录日志，不影响连接。
+ */
+struct SocketOptions {
+    bool noDelay = true;                        ///< TCP_NODELAY，关闭Nagle算法，小帧立即发出
+    int sendBufferSize = 0;                     ///< SO_SNDBUF（字节）
+    int receiveBufferSize = 0;                  ///< SO_RCVBUF（字节）
+    bool keepAlive = false;                     ///< SO_KEEPALIVE，在没有请求时也能发现断开的链路
+    std::chrono::seconds keepAliveIdle{10};     ///< TCP_KEEPIDLE，空闲多久后开始探测
+    std::chrono::seconds keepAliveInterval{2};  ///< TCP_KEEPINTVL，探测间隔
+    int keepAliveCount = 3;                     ///< TCP_KEEPCNT，连续多少次探测无响应判定断开
+    int busyPollMicroseconds = 0;               ///< SO_BUSY_POLL（微秒），接收时忙轮询网卡队列，0为关闭
+};
+
+/**
+ * @brief IO线程忙轮询配置
+ *
+ * 启用后IO线程（ASIO的IO线程池、EPOLL/IO_URING的事件循环线程）处理完事件后不立即休眠，
+ * 而是以零超时继续非阻塞地轮询socket，在自旋时长内没有新事件才阻塞等待（先自旋后休眠）。
+ * 省去线程在epoll中休眠和被唤醒的时延，代价是每个IO线程在自旋期间占满一个CPU核；
+ * 自旋时长应大于请求的往返时间，适合专用链路上的遥控等对时延敏感的场景。
+ */
+struct BusyPollOptions {
+    bool enabled = false;                          ///< 是否启用忙轮询
+    std::chrono::microseconds spinDuration{1000};  ///< 最后一个事件之后继续自旋的时长
+};
+
+/**
+ * @brief 线程调度策略
+ */
+enum class ThreadSchedulingPolicy {
+    DEFAULT = 0,     ///< 不修改（通常为 SCHED_OTHER）
+    FIFO = 1,        ///< SCHED_FIFO 实时调度
+    ROUND_ROBIN = 2  ///< SCHED_RR 实时调度
+};
+
+/**
+ * @brief SDK创建的线程（IO线程、EPOLL/IO_URING事件循环线程和主机名解析线程、专用回调线程、共享内存接收线程）的配置
+ *
+ * 设置实时调度通常需要 CAP_SYS_NICE 或 RLIMIT_RTPRIO；实时调度与忙轮询同时使用时，
+ * 应通过 cpuAffinity 把SDK线程放在独占的核上，否则自旋的线程会饿死同一核上的普通线程。
+ */
+struct ThreadOptions {
+    std::vector<int> cpuAffinity;                                     ///< 允许运行的CPU编号，为空时不设置
+    ThreadSchedulingPolicy policy = ThreadSchedulingPolicy::DEFAULT;  ///< 调度策略
+    int priority = 0;                                                 ///< 实时调度优先级（1-99），policy 为 DEFAULT 时不使用
+    std::string namePrefix = "rsdk";                                  ///< 线程名前缀，线程名为“前缀-用途”（如 rsdk-io0），超过15个字符时截断前缀；为空时不设置线程名
+};
+
+/**
+ * @brief 一项线程设置的结果
+ */
+enum class ThreadSettingResult {
+    NOT_REQUESTED = 0, ///< 未配置
+    APPLIED = 1,       ///< 已生效（已读回确认）
+    FAILED = 2         ///< 设置失败或读回的值与配置不同
+};
+
+/**
+ * @brief SDK创建的一个线程的设置结果
+ */
+struct ThreadStatus {
+    std::string name;                                                ///< 线程名（未设置线程名时为用途）
+    ThreadSettingResult nameResult = ThreadSettingResult::NOT_REQUESTED;       ///< 线程名
+    ThreadSettingResult affinityResult = ThreadSettingResult::NOT_REQUESTED;   ///< CPU亲和性
+    ThreadSettingResult schedulingResult = ThreadSettingResult::NOT_REQUESTED; ///< 调度策略和优先级
+    std::string error;                                               ///< 失败原因，全部成功时为空
+};
+
+/**
+ * @brief 传输层实现
+ */
+enum class TransportBackend {
+    ASIO = 0,   ///< Boost.Asio，运行在运行时的IO线程池上
+    EPOLL = 1,  ///< 原生epoll单线程事件循环（仅Linux），同一运行时的所有EPOLL连接共享一个线程
+    IO_URING = 2, ///< io_uring单线程事件循环（Linux 6.0及以上），同一运行时的所有IO_URING连接共享一个线程；内核不支持时回退到EPOLL
+    SHARED_MEMORY = 3 ///< POSIX共享内存环（仅Linux），用于同一主机上的仿真器；host为服务端创建的共享内存段名，port不使用
+};
+
+/**
+ * @brief 用户回调（导航结果、连接状态变化、异步连接结果）的执行方式
+ */
+enum class CallbackExecution {
+    INLINE = 0,           ///< 在IO线程中直接调用，回调耗时会阻塞同一IO线程上所有连接的收发
+    DEDICATED_THREAD = 1, ///< 投递到运行时的专用回调线程，同一运行时的所有SDK实例共享该线程，按派发顺序执行
+    EXECUTOR = 2,         ///< 交给 CallbackOptions::executor 执行（如调用方的线程池），执行顺序由执行器决定
+    EVENT_FD = 3          ///< 放入运行时的完成队列，队列非空时 completionEventFd() 可读，由调用方调用 drainCompletions() 在自己的线程中执行
+};
+
+/**
+ * @brief 用户提供的回调执行器，接收一个任务并在任意线程中执行它
+ */
+using CallbackExecutor = std::function<void(std::function<void()>)>;
+
+/**
+ * @brief 用户回调的执行配置
+ *
+ * 非 INLINE 方式下IO线程只把回调放入队列，慢回调不再阻塞接收。
+ * SDK析构时等待已派发的回调执行完，EXECUTOR 方式下执行器必须比SDK实例存活更久；
+ * EVENT_FD 方式下不等待，SDK析构后仍在完成队列中的回调在下一次 drainCompletions() 时执行。
+ */
+struct CallbackOptions {
+    CallbackExecution execution = CallbackExecution::INLINE; ///< 执行方式
+    CallbackExecutor executor;                               ///< EXECUTOR 方式使用的执行器，为空时回退到 INLINE
+};
+
+/**
+ * @brief 连接通道
+ *
+ * 启用 SdkOptions::dedicatedControlConnection 时SDK向RobotServer建立两条连接，
+ * 请求按类型自动选择连接；未启用时两个通道是同一条连接。
+ */
+enum class ConnectionChannel {
+    CONTROL = 0, ///< 运动控制命令（request2_*）
+    DATA = 1     ///< 状态查询（1002/1007/2102/2103）和导航任务（1003/1004）
+};
+
 /**
  * @brief SDK配置选项
  */
 struct SdkOptions {
     std::chrono::milliseconds connectionTimeout{5000}; ///< 连接超时时间
     std::chrono::milliseconds requestTimeout{3000};    ///< 请求超时时间
+    std::shared_ptr<SdkRuntime> runtime;               ///< 共享的运行时（IO线程池），为空时每个SDK实例创建自己的IO线程
+    ReconnectOptions reconnect;                        ///< 自动重连配置
+    SocketOptions socket;                              ///< socket选项
+    TransportBackend transport = TransportBackend::ASIO; ///< 传输层实现
+    SendQueueOptions sendQueue;                        ///< 发送队列容量和排队策略（启用独立控制连接时每条连接各一个队列）
+    bool dedicatedControlConnection = false;           ///< 为运动控制命令单独建立一条连接，不与遥测轮询和导航任务排在同一队列；SHARED_MEMORY 传输不支持
+    CallbackOptions callbacks;                         ///< 用户回调的执行方式
+    BusyPollOptions busyPoll;                          ///< runtime 为空时创建的运行时的IO线程忙轮询配置
+    ThreadOptions threads;                             ///< runtime 为空时创建的运行时中SDK线程的CPU亲和性、调度策略和线程名
+    bool callerDrivenIo = false;                       ///< runtime 为空时不创建IO线程，由调用方调用 RobotServerSdk::poll() 驱动收发；EPOLL/IO_URING 传输改用 ASIO
+};
+
+/**
+ * @brief 连接统计信息
+ *
+ * 平均每次写操作聚合的帧数 = framesSent / writeOperations，
+ * 平均每次写操作的字节数 = bytesSent / writeOperations。
+ */
+struct ConnectionStatistics {
+    uint64_t framesSent = 0;         ///< 已写出的帧数
+    uint64_t writeOperations = 0;    ///< 写操作次数（每次为一次聚合写）
+    uint64_t bytesSent = 0;          ///< 已写出的字节数
+    uint64_t maxFramesPerWrite = 0;  ///< 单次写操作聚合的最大帧数
+    uint64_t queueDepth = 0;         ///< 发送队列占用：已接受但尚未写完的帧数（含正在写出的批次）
+    uint64_t maxQueueDepth = 0;      ///< 发送队列历史最大深度
+    uint64_t framesDropped = 0;      ///< 因队列已满或链路拥塞而丢弃的帧数
+    uint64_t framesSuperseded = 0;   ///< 被更新的同类帧取代的帧数
+    uint64_t reconnectCount = 0;     ///< 自动重连成功次数
+    uint64_t rttSamples = 0;         ///< 往返时延样本数（收到响应的请求数，不含导航任务结果）
+    uint64_t rttLastMicros = 0;      ///< 最近一次往返时延（微秒）
+    uint64_t rttSmoothedMicros = 0;  ///< 平滑往返时延（微秒），每个新样本占1/8权重
+    uint64_t rttMinMicros = 0;       ///< 最小往返时延（微秒）
+    uint64_t rttMaxMicros = 0;       ///< 最大往返时延（微秒）
+};
+
+/**
+ * @brief 用户回调统计
+ *
+ * 排队时延为回调从派发（通常在IO线程中）到开始执行的时间，执行时长为用户回调函数本身的耗时。
+ */
+struct CallbackStatistics {
+    uint64_t callbacksDispatched = 0; ///< 已派发的回调数
+    uint64_t callbacksCompleted = 0;  ///< 已执行完的回调数
+    uint64_t queueDepth = 0;          ///< 已派发但尚未执行完的回调数
+    uint64_t avgQueueDelayMicros = 0; ///< 平均排队时延（微秒）
+    uint64_t maxQueueDelayMicros = 0; ///< 最大排队时延（微秒）
+    uint64_t avgDurationMicros = 0;   ///< 平均执行时长（微秒）
+    uint64_t maxDurationMicros = 0;   ///< 最大执行时长（微秒）
 };
 
 /**
@@ -289,6 +529,7 @@ struct RTKFusionData {
     float latitude = 0.0;          ///< 纬度（融合后）
     float elpHeight = 0.0;         ///< 椭球高（融合后）
     float yaw = 0.0;               ///< 偏航角度
+    int invalidFieldCount = 0;     ///< 响应中无法解析而保留默认值的字段数
 
     ErrorCode_RTKFusion errorCode = ErrorCode_RTKFusion::SUCCESS; ///< 错误码
 };
@@ -301,10 +542,21 @@ struct RTKRawData {
     float latitude = 0.0;          ///< 纬度（原始数据）
     float elpHeight = 0.0;         ///< 椭球高（原始数据）
     float yaw = 0.0;               ///< 偏航角度
+    int invalidFieldCount = 0;     ///< 响应中无法解析而保留默认值的字段数
 
     ErrorCode_RTKRaw errorCode = ErrorCode_RTKRaw::SUCCESS; ///< 错误码
 };
 
+/**
+ * @brief 异步连接结果回调函数类型，参数为是否连接成功
+ */
+using ConnectResultCallback = std::function<void(bool)>;
+
+/**
+ * @brief 连接状态变化回调函数类型
+ */
+using ConnectionStateCallback = std::function<void(ConnectionState)>;
+
 /**
  * @brief 导航任务结果回调函数类型
  */
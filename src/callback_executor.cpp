@@ -0,0 +1,260 @@
+#include "callback_executor.hpp"
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
+#include <system_error>
+
+namespace robotserver_sdk {
+
+namespace {
+
+// 当前线程正在执行的派发回调层数，在回调中析构SDK时不能等待自身
+thread_local int callback_depth = 0;
+
+void updateMax(std::atomic<uint64_t>& maximum, uint64_t value) {
+    uint64_t current = maximum.load(std::memory_order_relaxed);
+    while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t elapsedNanoseconds(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+    return elapsed > 0 ? static_cast<uint64_t>(elapsed) : 0;
+}
+
+}  // namespace
+
+CallbackThread::CallbackThread(const std::shared_ptr<network::ThreadConfigurator>& threads)
+    : state_(std::make_shared<State>()),
+      thread_([state = state_]() { run(*state); }) {
+    if (threads) {
+        threads->apply(thread_, "callback");
+    }
+}
+
+CallbackThread::~CallbackThread() {
+    state_->stop.store(true, std::memory_order_seq_cst);
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->wakeup.notify_one();
+    }
+    // 在回调中释放最后一个引用时无法等待自身结束，线程执行完剩余回调后自行退出
+    if (std::this_thread::get_id() == thread_.get_id()) {
+        thread_.detach();
+    } else if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void CallbackThread::post(Task task) {
+    state_->queue.push(std::move(task));
+    if (state_->sleeping.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->wakeup.notify_one();
+    }
+}
+
+void CallbackThread::run(State& state) {
+    Task task;
+    while (true) {
+        if (state.queue.pop(task)) {
+            try {
+                task();
+            } catch (const std::exception& e) {
+                std::cerr << "回调线程任务异常: " << e.what() << std::endl;
+            } catch (...) {
+                std::cerr << "回调线程任务发生未知异常" << std::endl;
+            }
+            task = nullptr;
+            continue;
+        }
+
+        // 已投递的回调全部执行完后才退出
+        if (state.stop.load(std::memory_order_seq_cst)) {
+            return;
+        }
+
+        // 先置休眠标志再检查队列，与投递方“先入队再检查标志”配对，不会丢失唤醒
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.sleeping.store(true, std::memory_order_seq_cst);
+        if (state.queue.empty() && !state.stop.load(std::memory_order_seq_cst)) {
+            state.wakeup.wait(lock);
+        }
+        state.sleeping.store(false, std::memory_order_relaxed);
+    }
+}
+
+CompletionQueue::CompletionQueue() {
+    event_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (event_fd_ < 0) {
+        throw std::system_error(errno, std::generic_category(), "eventfd");
+    }
+}
+
+CompletionQueue::~CompletionQueue() {
+    ::close(event_fd_);
+}
+
+void CompletionQueue::post(Task task) {
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+        notify = !signalled_;
+        signalled_ = true;
+    }
+    if (notify) {
+        uint64_t one = 1;
+        ssize_t ignored = ::write(event_fd_, &one, sizeof(one));
+        (void)ignored;
+    }
+}
+
+std::size_t CompletionQueue::drain() {
+    std::deque<Task> tasks;
+    {
+        // 先清除eventfd再取出回调，之后投递的回调会重新写入
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (signalled_) {
+            uint64_t value = 0;
+            ssize_t ignored = ::read(event_fd_, &value, sizeof(value));
+            (void)ignored;
+            signalled_ = false;
+        }
+        tasks.swap(tasks_);
+    }
+
+    for (auto& task : tasks) {
+        try {
+            task();
+        } catch (const std::exception& e) {
+            std::cerr << "完成队列回调异常: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "完成队列回调发生未知异常" << std::endl;
+        }
+    }
+    return tasks.size();
+}
+
+CallbackDispatcher::CallbackDispatcher(const CallbackOptions& options, std::shared_ptr<CallbackThread> thread,
+                                       std::shared_ptr<CompletionQueue> completions)
+    : execution_(options.execution),
+      executor_(options.executor),
+      thread_(std::move(thread)),
+      completions_(std::move(completions)),
+      metrics_(std::make_shared<Metrics>()) {
+    if (execution_ == CallbackExecution::EXECUTOR && !executor_) {
+        std::cerr << "未设置回调执行器，回调将在IO线程中直接调用" << std::endl;
+        execution_ = CallbackExecution::INLINE;
+    }
+    if (execution_ == CallbackExecution::DEDICATED_THREAD && !thread_) {
+        execution_ = CallbackExecution::INLINE;
+    }
+    if (execution_ == CallbackExecution::EVENT_FD && !completions_) {
+        execution_ = CallbackExecution::INLINE;
+    }
+}
+
+void CallbackDispatcher::dispatch(std::function<void()> callback) {
+    metrics_->dispatched.fetch_add(1, std::memory_order_relaxed);
+
+    if (execution_ == CallbackExecution::INLINE) {
+        // 回调中可能析构本对象，持有计数的副本
+        auto metrics = metrics_;
+        run(*metrics, callback, Clock::now());
+        return;
+    }
+
+    Clock::time_point queued = Clock::now();
+    std::function<void()> task = [metrics = metrics_, callback = std::move(callback), queued]() {
+        run(*metrics, callback, queued);
+    };
+
+    if (execution_ == CallbackExecution::DEDICATED_THREAD) {
+        thread_->post(std::move(task));
+        return;
+    }
+    if (execution_ == CallbackExecution::EVENT_FD) {
+        completions_->post(std::move(task));
+        return;
+    }
+
+    try {
+        executor_(task);
+    } catch (const std::exception& e) {
+        // 执行器拒绝任务（如已关闭）时仍然调用回调，避免等待结果的一方永远等不到
+        std::cerr << "回调执行器异常，回调将在当前线程中直接调用: " << e.what() << std::endl;
+        task();
+    } catch (...) {
+        std::cerr << "回调执行器发生未知异常，回调将在当前线程中直接调用" << std::endl;
+        task();
+    }
+}
+
+void CallbackDispatcher::run(Metrics& metrics, const std::function<void()>& callback, Clock::time_point queued) {
+    Clock::time_point start = Clock::now();
+    uint64_t delay = elapsedNanoseconds(queued, start);
+    metrics.queue_delay_total_ns.fetch_add(delay, std::memory_order_relaxed);
+    updateMax(metrics.queue_delay_max_ns, delay);
+
+    ++callback_depth;
+    try {
+        callback();
+    } catch (...) {
+        --callback_depth;
+        complete(metrics);
+        throw;
+    }
+    --callback_depth;
+
+    uint64_t duration = elapsedNanoseconds(start, Clock::now());
+    metrics.duration_total_ns.fetch_add(duration, std::memory_order_relaxed);
+    updateMax(metrics.duration_max_ns, duration);
+    complete(metrics);
+}
+
+void CallbackDispatcher::complete(Metrics& metrics) {
+    // 先计数再检查等待者，与 waitIdle()“先登记等待者再检查计数”配对，不会丢失唤醒
+    metrics.completed.fetch_add(1, std::memory_order_seq_cst);
+    if (metrics.waiters.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(metrics.mutex);
+        metrics.idle.notify_all();
+    }
+}
+
+CallbackStatistics CallbackDispatcher::statistics() const {
+    CallbackStatistics stats;
+    stats.callbacksCompleted = metrics_->completed.load(std::memory_order_acquire);
+    stats.callbacksDispatched = std::max(metrics_->dispatched.load(std::memory_order_relaxed), stats.callbacksCompleted);
+    stats.queueDepth = stats.callbacksDispatched - stats.callbacksCompleted;
+    if (stats.callbacksCompleted > 0) {
+        stats.avgQueueDelayMicros = metrics_->queue_delay_total_ns.load(std::memory_order_relaxed) /
+                                    stats.callbacksCompleted / 1000;
+        stats.avgDurationMicros = metrics_->duration_total_ns.load(std::memory_order_relaxed) /
+                                  stats.callbacksCompleted / 1000;
+    }
+    stats.maxQueueDelayMicros = metrics_->queue_delay_max_ns.load(std::memory_order_relaxed) / 1000;
+    stats.maxDurationMicros = metrics_->duration_max_ns.load(std::memory_order_relaxed) / 1000;
+    return stats;
+}
+
+void CallbackDispatcher::waitIdle() const {
+    // EVENT_FD 方式的回调只在调用方 drain 时执行，等待可能永远不会结束
+    if (callback_depth > 0 || execution_ == CallbackExecution::EVENT_FD) {
+        return;
+    }
+    Metrics& metrics = *metrics_;
+    metrics.waiters.fetch_add(1, std::memory_order_seq_cst);
+    {
+        std::unique_lock<std::mutex> lock(metrics.mutex);
+        metrics.idle.wait(lock, [&metrics]() {
+            return metrics.completed.load(std::memory_order_seq_cst) >=
+                   metrics.dispatched.load(std::memory_order_seq_cst);
+        });
+    }
+    metrics.waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace robotserver_sdk
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "types.h"
+#include "mpsc_queue.hpp"
+#include "network/thread_settings.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace robotserver_sdk {
+
+/**
+ * @brief 专用回调线程
+ *
+ * IO线程通过无锁MPSC队列投递回调，投递不加锁，也不等待回调执行；
+ * 线程空闲时在条件变量上休眠，只有它休眠时投递方才需要加锁唤醒。
+ * 同一运行时的所有SDK实例共享一个回调线程，回调按投递顺序执行。
+ */
+class CallbackThread {
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief 构造函数，立即启动线程
+     * @param threads 线程配置，为空时使用默认属性
+     */
+    explicit CallbackThread(const std::shared_ptr<network::ThreadConfigurator>& threads = nullptr);
+
+    /**
+     * @brief 析构函数，执行完已投递的回调后停止线程
+     */
+    ~CallbackThread();
+
+    CallbackThread(const CallbackThread&) = delete;
+    CallbackThread& operator=(const CallbackThread&) = delete;
+
+    /**
+     * @brief 投递回调（任意线程可调用）
+     */
+    void post(Task task);
+
+private:
+    // 线程与本对象共享，本对象在回调线程中析构时线程分离后仍可安全访问
+    struct State {
+        MpscQueue<Task> queue;
+        std::atomic<bool> sleeping{false}; // 回调线程正在（或即将）等待条件变量
+        std::atomic<bool> stop{false};
+        std::mutex mutex;
+        std::condition_variable wakeup;
+    };
+
+    static void run(State& state);
+
+    std::shared_ptr<State> state_;
+    std::thread thread_;
+};
+
+/**
+ * @brief 由调用方执行的完成队列
+ *
+ * IO线程把回调放入队列，队列由空变为非空时写一次eventfd；调用方在自己的事件循环中
+ * 监听 fd() 可读，调用 drain() 在调用线程中执行所有排队的回调并清除eventfd。
+ * 两次 drain() 之间无论投递多少回调，eventfd 只被写一次。同一运行时的所有SDK实例共享一个队列。
+ */
+class CompletionQueue {
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief 构造函数，创建eventfd
+     * @throws std::system_error 创建eventfd失败
+     */
+    CompletionQueue();
+
+    /**
+     * @brief 析构函数，关闭eventfd，未执行的回调被丢弃
+     */
+    ~CompletionQueue();
+
+    CompletionQueue(const CompletionQueue&) = delete;
+    CompletionQueue& operator=(const CompletionQueue&) = delete;
+
+    /**
+     * @brief 队列非空时可读的eventfd（非阻塞）
+     */
+    int fd() const { return event_fd_; }
+
+    /**
+     * @brief 投递回调（任意线程可调用）
+     */
+    void post(Task task);
+
+    /**
+     * @brief 在调用线程中执行所有排队的回调
+     * @return 执行的回调数
+     */
+    std::size_t drain();
+
+private:
+    int event_fd_ = -1;
+    std::mutex mutex_;
+    std::deque<Task> tasks_;
+    bool signalled_ = false; // eventfd 已被写入且尚未清除
+};
+
+/**
+ * @brief 单个SDK实例的用户回调派发器
+ *
+ * 按 CallbackOptions 选择执行方式，并统计排队时延和执行时长。
+ * 统计数据由派发的任务共享持有，派发器先于任务销毁也是安全的。
+ */
+class CallbackDispatcher {
+public:
+    /**
+     * @brief 构造函数
+     * @param options 回调执行配置
+     * @param thread 专用回调线程，仅 DEDICATED_THREAD 方式使用
+     * @param completions 完成队列，仅 EVENT_FD 方式使用
+     */
+    CallbackDispatcher(const CallbackOptions& options, std::shared_ptr<CallbackThread> thread,
+                       std::shared_ptr<CompletionQueue> completions = nullptr);
+
+    /**
+     * @brief 派发回调
+     * @param callback 回调任务，需自行捕获异常
+     */
+    void dispatch(std::function<void()> callback);
+
+    /**
+     * @brief 获取回调统计
+     */
+    CallbackStatistics statistics() const;
+
+    /**
+     * @brief 等待已派发的回调全部执行完；在回调中调用时或 EVENT_FD 方式下立即返回
+     */
+    void waitIdle() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Metrics {
+        std::atomic<uint64_t> dispatched{0};
+        std::atomic<uint64_t> completed{0};
+        std::atomic<uint64_t> queue_delay_total_ns{0};
+        std::atomic<uint64_t> queue_delay_max_ns{0};
+        std::atomic<uint64_t> duration_total_ns{0};
+        std::atomic<uint64_t> duration_max_ns{0};
+        std::atomic<int> waiters{0}; // 正在 waitIdle() 中等待的线程数，为0时完成回调不加锁
+        std::mutex mutex;
+        std::condition_variable idle;
+    };
+
+    /**
+     * @brief 执行回调并记录排队时延和执行时长
+     */
+    static void run(Metrics& metrics, const std::function<void()>& callback, Clock::time_point queued);
+
+    /**
+     * @brief 记录一个回调执行完成，有线程在 waitIdle() 中等待时唤醒它
+     */
+    static void complete(Metrics& metrics);
+
+    CallbackExecution execution_;
+    CallbackExecutor executor_;
+    std::shared_ptr<CallbackThread> thread_;
+    std::shared_ptr<CompletionQueue> completions_;
+    std::shared_ptr<Metrics> metrics_;
+};
+
+} // namespace robotserver_sdk
@@ -0,0 +1,295 @@
+#include <fleet_sdk.h>
+#include <algorithm>
+#include <condition_variable>
+#include <iostream>
+
+#include "robotserver_sdk_impl.hpp"
+
+namespace robotserver_sdk {
+
+namespace {
+
+using RobotList = std::vector<std::pair<std::string, std::shared_ptr<RobotServerSdkImpl>>>;
+
+/**
+ * @brief 批量请求：先向所有机器狗发出请求，再用同一个截止时间统一等待
+ * @param robots 机器狗快照
+ * @param timeout 整体超时时间
+ * @param begin 发出单个请求
+ * @param finish 等待单个响应并转换结果
+ * @return 机器狗ID到结果的映射
+ */
+template <typename Result, typename Begin, typename Finish>
+std::map<std::string, Result> fanOut(const RobotList& robots, std::chrono::milliseconds timeout, Begin begin, Finish finish) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    std::vector<RobotServerSdkImpl::RequestTicket> tickets(robots.size());
+    for (std::size_t i = 0; i < robots.size(); ++i) {
+        try {
+            tickets[i] = begin(*robots[i].second);
+        } catch (const std::exception& e) {
+            std::cerr << "批量请求 " << robots[i].first << " 发送异常: " << e.what() << std::endl;
+        }
+    }
+
+    std::map<std::string, Result> results;
+    for (std::size_t i = 0; i < robots.size(); ++i) {
+        results.emplace(robots[i].first, finish(*robots[i].second, tickets[i], deadline));
+    }
+    return results;
+}
+
+}  // namespace
+
+FleetSdk::FleetSdk(const SdkOptions& options)
+    : options_(options) {
+    if (!options_.runtime) {
+        options_.runtime = std::make_shared<SdkRuntime>(std::max(1u, std::thread::hardware_concurrency()),
+                                                        options_.busyPoll, options_.threads);
+        // 已用于共享运行时，各SDK实例不再单独配置
+        options_.busyPoll = BusyPollOptions();
+        options_.threads = ThreadOptions();
+    }
+}
+
+FleetSdk::~FleetSdk() = default;
+
+bool FleetSdk::addRobot(const std::string& robotId, const std::string& host, uint16_t port) {
+    {
+        std::lock_guard<std::mutex> lock(robots_mutex_);
+        if (robots_.count(robotId)) {
+            std::cerr << "addRobot 失败: 机器狗ID已存在 " << robotId << std::endl;
+            return false;
+        }
+    }
+
+    // 创建SDK实例（传输层、运行时资源）不持有锁；检查之后其他线程可能已加入同一ID，插入时再次确认
+    auto sdk = std::make_shared<RobotServerSdkImpl>(options_);
+    {
+        std::lock_guard<std::mutex> lock(robots_mutex_);
+        if (!robots_.emplace(robotId, RobotEntry{host, port, sdk}).second) {
+            std::cerr << "addRobot 失败: 机器狗ID已存在 " << robotId << std::endl;
+            return false;
+        }
+    }
+
+    return sdk->connect(host, port);
+}
+
+std::map<std::string, bool> FleetSdk::addRobots(const std::vector<RobotEndpoint>& robots, std::size_t maxConcurrentConnects) {
+    std::map<std::string, bool> results;
+    std::vector<const RobotEndpoint*> candidates;
+    {
+        std::lock_guard<std::mutex> lock(robots_mutex_);
+        for (const auto& robot : robots) {
+            // 已存在的ID和列表中重复的ID都不创建SDK实例，加入的机器狗在连接完成后更新结果
+            bool exists = robots_.count(robot.robotId) || results.count(robot.robotId);
+            results[robot.robotId] = false;
+            if (exists) {
+                std::cerr << "addRobots: 机器狗ID已存在 " << robot.robotId << std::endl;
+                continue;
+            }
+            candidates.push_back(&robot);
+        }
+    }
+
+    // 创建SDK实例不持有锁
+    std::vector<std::pair<std::string, RobotEntry>> created;
+    created.reserve(candidates.size());
+    for (const RobotEndpoint* robot : candidates) {
+        created.emplace_back(robot->robotId,
+                             RobotEntry{robot->host, robot->port, std::make_shared<RobotServerSdkImpl>(options_)});
+    }
+
+    std::vector<std::pair<std::string, RobotEntry>> added;
+    {
+        std::lock_guard<std::mutex> lock(robots_mutex_);
+        for (auto& robot : created) {
+            if (!robots_.emplace(robot.first, robot.second).second) {
+                std::cerr << "addRobots: 机器狗ID已存在 " << robot.first << std::endl;
+                continue;
+            }
+            added.push_back(std::move(robot));
+        }
+    }
+
+    auto connected = parallelConnect(added, maxConcurrentConnects);
+    for (const auto& result : connected) {
+        results[result.first] = result.second;
+    }
+    return results;
+}
+
+std::map<std::string, bool> FleetSdk::connectAll(std::size_t maxConcurrentConnects) {
+    std::map<std::string, bool> results;
+    std::vector<std::pair<std::string, RobotEntry>> pending;
+    {
+        std::lock_guard<std::mutex> lock(robots_mutex_);
+        for (const auto& robot : robots_) {
+            if (robot.second.sdk->isConnected()) {
+                results[robot.first] = true;
+            } else {
+                pending.emplace_back(robot.first, robot.second);
+            }
+        }
+    }
+
+    auto connected = parallelConnect(pending, maxConcurrentConnects);
+    results.insert(connected.begin(), connected.end());
+    return results;
+}
+
+std::map<std::string, bool> FleetSdk::parallelConnect(const std::vector<std::pair<std::string, RobotEntry>>& robots,
+                                                      std::size_t maxConcurrentConnects) {
+    std::map<std::string, bool> failed;
+    if (robots.empty()) {
+        return failed;
+    }
+
+    // 连接在IO线程中完成，在IO线程（如 INLINE 方式的用户回调）中等待会永远阻塞
+    if (robots.front().second.sdk->runningInIoThread()) {
+        std::cerr << "连接失败: 不能在IO线程中批量连接" << std::endl;
+        for (const auto& robot : robots) {
+            failed[robot.first] = false;
+        }
+        return failed;
+    }
+
+    // 共享状态：每个连接完成后在IO线程中启动下一个，调用线程只等待全部完成
+    struct State {
+        std::vector<std::pair<std::string, RobotEntry>> robots;
+        std::mutex mutex;
+        std::condition_variable done;
+        std::size_t next = 0;
+        std::size_t completed = 0;
+        std::map<std::string, bool> results;
+        std::function<void(const std::shared_ptr<State>&)> start_next;
+    };
+    auto state = std::make_shared<State>();
+    state->robots = robots;
+
+    state->start_next = [](const std::shared_ptr<State>& state) {
+        std::size_t index;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->next >= state->robots.size()) {
+                return;
+            }
+            index = state->next++;
+        }
+
+        // 内部等待连接完成，结果不经过用户回调的派发方式（EVENT_FD 方式下要等调用方取出才执行）
+        const auto& robot = state->robots[index];
+        robot.second.sdk->connectAsyncInternal(robot.second.host, robot.second.port, [state, index](bool connected) {
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->results[state->robots[index].first] = connected;
+                ++state->completed;
+            }
+            state->done.notify_all();
+            state->start_next(state);
+        });
+    };
+
+    std::size_t concurrency = std::min(std::max<std::size_t>(maxConcurrentConnects, 1), robots.size());
+    for (std::size_t i = 0; i < concurrency; ++i) {
+        state->start_next(state);
+    }
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    if (options_.runtime->ioThreadCount() == 0) {
+        // 调用方驱动的运行时没有IO线程，在本线程中驱动连接完成
+        while (state->completed < state->robots.size()) {
+            lock.unlock();
+            options_.runtime->poll(std::chrono::milliseconds(10));
+            lock.lock();
+        }
+        return state->results;
+    }
+    state->done.wait(lock, [&state]() { return state->completed == state->robots.size(); });
+    return state->results;
+}
+
+bool FleetSdk::removeRobot(const std::string& robotId) {
+    std::shared_ptr<RobotServerSdkImpl> sdk;
+    {
+        std::lock_guard<std::mutex> lock(robots_mutex_);
+        auto it = robots_.find(robotId);
+        if (it == robots_.end()) {
+            return false;
+        }
+        sdk = std::move(it->second.sdk);
+        robots_.erase(it);
+    }
+
+    sdk->disconnect();
+    return true;
+}
+
+std::vector<std::string> FleetSdk::robotIds() const {
+    std::lock_guard<std::mutex> lock(robots_mutex_);
+    std::vector<std::string> ids;
+    ids.reserve(robots_.size());
+    for (const auto& robot : robots_) {
+        ids.push_back(robot.first);
+    }
+    return ids;
+}
+
+bool FleetSdk::isConnected(const std::string& robotId) const {
+    std::lock_guard<std::mutex> lock(robots_mutex_);
+    auto it = robots_.find(robotId);
+    return it != robots_.end() && it->second.sdk->isConnected();
+}
+
+std::map<std::string, RealTimeStatus> FleetSdk::requestAll1002_RunTimeState() {
+    return fanOut<RealTimeStatus>(snapshot(), options_.requestTimeout,
+        [](RobotServerSdkImpl& sdk) { return sdk.begin1002_RunTimeState(); },
+        [](RobotServerSdkImpl& sdk, RobotServerSdkImpl::RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+            return sdk.finish1002_RunTimeState(ticket, deadline);
+        });
+}
+
+std::map<std::string, TaskStatusResult> FleetSdk::requestAll1007_NavTaskState() {
+    return fanOut<TaskStatusResult>(snapshot(), options_.requestTimeout,
+        [](RobotServerSdkImpl& sdk) { return sdk.begin1007_NavTaskState(); },
+        [](RobotServerSdkImpl& sdk, RobotServerSdkImpl::RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+            return sdk.finish1007_NavTaskState(ticket, deadline);
+        });
+}
+
+std::map<std::string, RTKFusionData> FleetSdk::requestAll2102_RTKFusionData() {
+    return fanOut<RTKFusionData>(snapshot(), options_.requestTimeout,
+        [](RobotServerSdkImpl& sdk) { return sdk.begin2102_RTKFusionData(); },
+        [](RobotServerSdkImpl& sdk, RobotServerSdkImpl::RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+            return sdk.finish2102_RTKFusionData(ticket, deadline);
+        });
+}
+
+std::map<std::string, RTKRawData> FleetSdk::requestAll2103_RTKRawData() {
+    return fanOut<RTKRawData>(snapshot(), options_.requestTimeout,
+        [](RobotServerSdkImpl& sdk) { return sdk.begin2103_RTKRawData(); },
+        [](RobotServerSdkImpl& sdk, RobotServerSdkImpl::RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+            return sdk.finish2103_RTKRawData(ticket, deadline);
+        });
+}
+
+std::map<std::string, MotionControlResult> FleetSdk::requestAll2_ActionControl(ActionCommand cmd) {
+    return fanOut<MotionControlResult>(snapshot(), options_.requestTimeout,
+        [cmd](RobotServerSdkImpl& sdk) { return sdk.begin2_MotionControl(static_cast<int>(cmd), 0); },
+        [](RobotServerSdkImpl& sdk, RobotServerSdkImpl::RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+            return sdk.finish2_MotionControl(ticket, deadline);
+        });
+}
+
+std::vector<std::pair<std::string, std::shared_ptr<RobotServerSdkImpl>>> FleetSdk::snapshot() const {
+    std::lock_guard<std::mutex> lock(robots_mutex_);
+    RobotList robots;
+    robots.reserve(robots_.size());
+    for (const auto& robot : robots_) {
+        robots.emplace_back(robot.first, robot.second.sdk);
+    }
+    return robots;
+}
+
+} // namespace robotserver_sdk
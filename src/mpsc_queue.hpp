@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace robotserver_sdk {
+
+/**
+ * @brief 无锁多生产者单消费者队列（Vyukov侵入式链表）
+ *
+ * 生产者只做一次原子交换和一次原子存储，不会相互阻塞；
+ * 只能有一个线程调用 pop()。生产者在交换和链接之间被抢占时，
+ * 其后入队的元素暂时不可见，pop() 返回false，链接完成后即可取出。
+ */
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue() : head_(new Node()), tail_(head_.load(std::memory_order_relaxed)) {}
+
+    ~MpscQueue() {
+        T value;
+        while (pop(value)) {
+        }
+        delete tail_;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /**
+     * @brief 入队（任意线程可调用）
+     */
+    void push(T value) {
+        Node* node = new Node(std::move(value));
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        // 顺序一致的链接与消费者“先置休眠标志再调用 empty()”配对，生产者随后检查休眠标志不会丢失唤醒
+        prev->next.store(node, std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief 出队（只能在消费者线程中调用）
+     * @param value 输出参数，队首元素
+     * @return 队列为空时返回false
+     */
+    bool pop(T& value) {
+        Node* next = tail_->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        value = std::move(next->value);
+        delete tail_;
+        tail_ = next;
+        return true;
+    }
+
+    /**
+     * @brief 队列中是否有可取出的元素（只能在消费者线程中调用）
+     */
+    bool empty() const {
+        return tail_->next.load(std::memory_order_seq_cst) == nullptr;
+    }
+
+private:
+    struct Node {
+        Node() = default;
+        explicit Node(T v) : value(std::move(v)) {}
+
+        std::atomic<Node*> next{nullptr};
+        T value{};
+    };
+
+    std::atomic<Node*> head_; // 最后入队的节点，生产者在此追加
+    Node* tail_;              // 哨兵节点，其后继为队首，只由消费者访问
+};
+
+} // namespace robotserver_sdk
@@ -1,142 +1,228 @@
 #include "asio_network_model.hpp"
 #include "protocol/serializer.hpp"
+#include "socket_address.hpp"
+#include "socket_options.hpp"
+#include "safe_callback.hpp"
 #include <iostream>
 #include <chrono>
-#include <sstream>
-#include <iomanip>
+#include <future>
+#include <vector>
 
 namespace network {
 
-AsioNetworkModel::AsioNetworkModel(INetworkCallback& callback)
-    : socket_(io_context_),
+AsioNetworkModel::AsioNetworkModel(INetworkCallback& callback, std::shared_ptr<IoContextPool> pool)
+    : pool_(std::move(pool)),
+      io_context_(pool_->context()),
+      socket_(io_context_),
       strand_(io_context_),
       connected_(false),
       callback_(callback) {
 }
 
-AsioNetworkModel::~AsioNetworkModel() {
-    disconnect();
-}
+AsioNetworkModel::~AsioNetworkModel() = default;
 
 void AsioNetworkModel::setConnectionTimeout(std::chrono::milliseconds timeout) {
     connection_timeout_ = timeout;
 }
 
+void AsioNetworkModel::setSocketOptions(const robotserver_sdk::SocketOptions& options) {
+    socket_options_ = options;
+}
+
+void AsioNetworkModel::setSendQueueOptions(const robotserver_sdk::SendQueueOptions& options) {
+    outbound_queue_.setOptions(options);
+}
+
+/**
+ * @brief 一次连接尝试的状态，由解析、连接和超时处理函数共享
+ */
+struct AsioNetworkModel::ConnectAttempt {
+    ConnectAttempt(boost::asio::io_context& io_context, ConnectCallback cb)
+        : resolver(io_context), timer(io_context), callback(std::move(cb)) {}
+
+    boost::asio::ip::tcp::resolver resolver;
+    boost::asio::steady_timer timer;
+    ConnectCallback callback;
+    bool timed_out = false;
+    bool done = false; // 已结束，之后到达的超时处理函数不再取消socket上的操作
+};
+
 bool AsioNetworkModel::connect(const std::string& host, uint16_t port) {
     // 如果已经连接，直接返回成功
     if (connected_) {
         return true;
     }
 
-    try {
-        // 重置io_context，确保它处于干净状态
-        io_context_.restart();
-
-        // 解析主机地址
-        boost::asio::ip::tcp::resolver resolver(io_context_);
-        auto endpoints = resolver.resolve(host, std::to_string(port));
-
-        // 设置连接超时
-        socket_.close(); // 确保套接字是关闭的
-        socket_ = boost::asio::ip::tcp::socket(io_context_); // 重新创建套接字
-
-        // 使用async_connect启动异步连接
-        boost::system::error_code connect_ec;
-        bool connect_completed = false;
-
-        // 开始异步连接
-        boost::asio::async_connect(socket_, endpoints,
-            [&connect_ec, &connect_completed](const boost::system::error_code& ec, const boost::asio::ip::tcp::endpoint&) {
-                connect_ec = ec;
-                connect_completed = true;
-            });
-
-        // 创建一个定时器用于超时控制
-        boost::asio::steady_timer timeout_timer(io_context_);
-        timeout_timer.expires_after(connection_timeout_);
-        timeout_timer.async_wait([this, &connect_completed](const boost::system::error_code& ec) {
-            if (!ec && !connect_completed) {
-                // 超时，取消连接操作
-                socket_.cancel();
-            }
-        });
+    // 在IO线程中同步等待连接完成会导致死锁
+    if (pool_->runningInThisThread()) {
+        std::cerr << "连接失败: 不能在IO线程中同步连接" << std::endl;
+        return false;
+    }
 
-        // 运行io_context直到连接完成或超时
-        while (!connect_completed && io_context_.run_one()) {
-            // 继续运行直到有事件发生
-        }
+    auto result = std::make_shared<std::promise<bool>>();
+    std::future<bool> result_future = result->get_future();
+    connectAsync(host, port, [result](bool connected) {
+        result->set_value(connected);
+    });
 
-        // 取消定时器
-        timeout_timer.cancel();
+    // 调用方驱动时等待期间自行执行IO处理函数
+    pool_->wait(result_future);
+    return result_future.get();
+}
 
-        // 检查连接是否成功
-        if (connect_ec || !connect_completed) {
-            std::cerr << "连接失败: " << connect_ec.message() << std::endl;
-            socket_.close();
-            return false;
+void AsioNetworkModel::connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) {
+    auto self = shared_from_this();
+    boost::asio::post(strand_, [this, self, host, port, callback = std::move(callback)]() mutable {
+        // 如果已经连接，直接返回成功；同一连接同时只允许一个连接尝试
+        if (connected_ || connecting_) {
+            if (connecting_) {
+                std::cerr << "连接失败: 已有连接尝试正在进行" << std::endl;
+            }
+            if (callback) {
+                safeCallback(callback, "连接结果", static_cast<bool>(connected_));
+            }
+            return;
         }
-
-        // 连接成功
-        connected_ = true;
-
-        // 确保之前的IO线程已经结束
-        if (io_thread_.joinable()) {
-            io_thread_.join();
+        connecting_ = true;
+
+        // 清空上一次连接残留的收发状态
+        boost::system::error_code ignored;
+        socket_.close(ignored);
+        decoder_.reset();
+        outbound_queue_.clear();
+
+        auto attempt = std::make_shared<ConnectAttempt>(io_context_, std::move(callback));
+
+        // 超时时间覆盖域名解析和连接两个阶段
+        attempt->timer.expires_after(connection_timeout_);
+        attempt->timer.async_wait(boost::asio::bind_executor(strand_,
+            [this, self, attempt](const boost::system::error_code& ec) {
+                // 定时器已到期、处理函数已在strand中排队时 cancel() 无效，连接可能已经完成
+                if (ec || attempt->done) {
+                    return;
+                }
+                // 超时，取消解析或连接操作
+                attempt->timed_out = true;
+                attempt->resolver.cancel();
+                boost::system::error_code ignored;
+                socket_.cancel(ignored);
+            }));
+
+        // Unix域socket地址不需要解析，直接连接
+        if (isUnixEndpoint(host)) {
+            sockaddr_storage address{};
+            socklen_t length = 0;
+            if (!resolveEndpoint(host, port, address, length)) {
+                finishConnect(attempt, boost::asio::error::invalid_argument);
+                return;
+            }
+            socket_.async_connect(boost::asio::generic::stream_protocol::endpoint(&address, length),
+                boost::asio::bind_executor(strand_, [this, self, attempt](const boost::system::error_code& ec) {
+                    finishConnect(attempt, ec);
+                }));
+            return;
         }
 
-        // 启动IO线程
-        io_thread_ = std::thread(&AsioNetworkModel::ioThreadFunc, this);
+        attempt->resolver.async_resolve(host, std::to_string(port), boost::asio::bind_executor(strand_,
+            [this, self, attempt](const boost::system::error_code& ec, boost::asio::ip::tcp::resolver::results_type results) {
+                if (ec || attempt->timed_out) {
+                    finishConnect(attempt, ec);
+                    return;
+                }
+
+                std::vector<boost::asio::generic::stream_protocol::endpoint> endpoints;
+                for (const auto& entry : results) {
+                    endpoints.emplace_back(entry.endpoint());
+                }
+                boost::asio::async_connect(socket_, endpoints, boost::asio::bind_executor(strand_,
+                    [this, self, attempt](const boost::system::error_code& ec,
+                                          const boost::asio::generic::stream_protocol::endpoint&) {
+                        finishConnect(attempt, ec);
+                    }));
+            }));
+    });
+}
+
+void AsioNetworkModel::finishConnect(const std::shared_ptr<ConnectAttempt>& attempt, boost::system::error_code error) {
+    connecting_ = false;
+    attempt->done = true;
+    attempt->timer.cancel();
+    if (attempt->timed_out) {
+        error = boost::asio::error::timed_out;
+    }
 
-        // 启动接收
+    if (error) {
+        std::cerr << "连接失败: " << error.message() << std::endl;
+        boost::system::error_code ignored;
+        socket_.close(ignored);
+    } else {
+        // 连接成功，设置socket选项后启动接收
+        applySocketOptions(socket_.native_handle(), socket_options_);
+        native_handle_ = socket_.native_handle();
+        connected_ = true;
         startReceive();
+    }
 
-        return true;
-    } catch (const std::exception& e) {
-        std::cerr << "连接异常: " << e.what() << std::endl;
-        return false;
-    } catch (...) {
-        std::cerr << "连接异常: 未知异常" << std::endl;
-        return false;
+    if (attempt->callback) {
+        safeCallback(attempt->callback, "连接结果", !error);
     }
 }
 
 void AsioNetworkModel::disconnect() {
-    if (!connected_ && !socket_.is_open()) {
-        return;
-    }
-
     try {
-        // 取消所有异步操作
-        boost::system::error_code ec;
-        socket_.cancel(ec);
+        // 已在本连接的 strand 中（如收发出错），直接关闭
+        if (strand_.running_in_this_thread()) {
+            closeSocket();
+            return;
+        }
 
         // 使用 strand 确保安全关闭
-        boost::asio::post(strand_, [this]() {
-            // 关闭socket
-            boost::system::error_code error;
-            socket_.close(error);
-
-            if (error) {
-                std::cerr << "关闭socket错误: " << error.message() << std::endl;
-            }
+        auto self = shared_from_this();
+        auto closed = std::make_shared<std::promise<void>>();
+        std::future<void> closed_future = closed->get_future();
+        boost::asio::post(strand_, [this, self, closed]() {
+            closeSocket();
+            closed->set_value();
         });
 
-        // 停止IO上下文
-        io_context_.stop();
-
-        // 等待IO线程结束
-        if (io_thread_.joinable()) {
-            io_thread_.join();
+        // 在IO线程中（如其他连接的回调里）不能等待，关闭将异步完成
+        if (!pool_->runningInThisThread()) {
+            pool_->wait(closed_future);
         }
-
-        connected_ = false;
     } catch (const std::exception& e) {
         std::cerr << "断开连接异常: " << e.what() << std::endl;
     }
 }
 
+void AsioNetworkModel::closeSocket() {
+    connected_ = false;
+    native_handle_ = -1;
+
+    // 关闭socket，未完成的异步操作将以 operation_aborted 结束
+    boost::system::error_code error;
+    socket_.close(error);
+    if (error) {
+        std::cerr << "关闭socket错误: " << error.message() << std::endl;
+    }
+}
+
+void AsioNetworkModel::connectionLost() {
+    // 已经关闭（主动断开或另一方向已报告错误）时不重复通知
+    if (!connected_) {
+        return;
+    }
+    closeSocket();
+
+    safeCallback(
+        [this]() {
+            callback_.onConnectionStateChanged(robotserver_sdk::ConnectionState::DISCONNECTED);
+        },
+        "连接状态变化"
+    );
+}
+
 bool AsioNetworkModel::isConnected() const {
-    return connected_ && socket_.is_open();
+    return connected_;
 }
 
 bool AsioNetworkModel::sendMessage(const protocol::IMessage& message) {
@@ -145,25 +231,30 @@ bool AsioNetworkModel::sendMessage(const protocol::IMessage& message) {
     }
 
     try {
-        // 序列化消息
+        // 序列化消息，协议头和消息体分开存放，避免拼接拷贝；消息体复用已写出帧的缓冲区
         protocol::Serializer serializer;
-        std::string data = serializer.serializeMessage(message);
+        protocol::SerializedFrame frame;
+        frame.body = outbound_queue_.acquireBody();
+        serializer.serializeFrame(message, frame);
 
-        // 使用 strand 包装异步写入操作，确保线程安全
-        boost::asio::post(strand_, [this, data = std::move(data)]() {
+        // 在 strand 中入队，同一连接上始终只有一个写操作在进行
+        boost::asio::post(strand_, [this, self = shared_from_this(), frame = std::move(frame)]() mutable {
             if (!isConnected()) {
                 return;
             }
 
-            boost::asio::async_write(
-                socket_,
-                boost::asio::buffer(data),
-                boost::asio::bind_executor(strand_,
-                    [this](const boost::system::error_code& error, std::size_t bytes_transferred) {
-                        onSend(error, bytes_transferred);
-                    }
-                )
-            );
+            if (auto dropped = outbound_queue_.push(std::move(frame))) {
+                safeCallback(
+                    [this](uint16_t sequence) {
+                        callback_.onSendFailed(sequence);
+                    },
+                    "发送失败",
+                    *dropped
+                );
+            }
+            if (!outbound_queue_.writeInProgress()) {
+                writeQueued();
+            }
         });
 
         return true;
@@ -173,72 +264,86 @@ bool AsioNetworkModel::sendMessage(const protocol::IMessage& message) {
     }
 }
 
+void AsioNetworkModel::detachCallback() {
+    callback_.close();
+}
+
+robotserver_sdk::ConnectionStatistics AsioNetworkModel::getStatistics() const {
+    robotserver_sdk::ConnectionStatistics stats;
+    outbound_queue_.fillStatistics(stats);
+    return stats;
+}
+
+int AsioNetworkModel::nativeHandle() const {
+    return native_handle_;
+}
+
+void AsioNetworkModel::writeQueued() {
+    // 协议头和消息体作为独立缓冲区，排队帧（优先通道在前）聚合为一次写操作（writev）
+    write_buffers_.clear();
+    for (const auto& frame : outbound_queue_.beginBatch()) {
+        write_buffers_.push_back(boost::asio::buffer(&frame.header, protocol::PROTOCOL_HEADER_SIZE));
+        write_buffers_.push_back(boost::asio::buffer(frame.body));
+    }
+
+    boost::asio::async_write(
+        socket_,
+        write_buffers_,
+        boost::asio::bind_executor(strand_,
+            [this, self = shared_from_this()](const boost::system::error_code& error, std::size_t bytes_transferred) {
+                onSend(error, bytes_transferred);
+            }
+        )
+    );
+}
+
 void AsioNetworkModel::startReceive() {
     if (!isConnected()) {
         return;
     }
 
+    // 直接读入帧解码器的环形缓冲区，避免额外拷贝
+    std::size_t writable = 0;
+    char* buffer = decoder_.prepare(writable);
+
     // 使用 strand 包装异步读取操作，确保线程安全
     socket_.async_read_some(
-        boost::asio::buffer(receive_buffer_),
+        boost::asio::buffer(buffer, writable),
         boost::asio::bind_executor(strand_,
-            [this](const boost::system::error_code& error, std::size_t bytes_transferred) {
+            [this, self = shared_from_this()](const boost::system::error_code& error, std::size_t bytes_transferred) {
                 onReceive(error, bytes_transferred);
             }
         )
     );
 }
 
-/**
- * @brief 安全回调包装函数，用于捕获和处理回调函数中可能抛出的异常
- * @tparam Callback 回调函数类型
- * @tparam Args 回调函数参数类型
- * @param callback 回调函数
- * @param callbackType 回调函数类型描述，用于日志记录
- * @param args 回调函数参数
- */
-template<typename Callback, typename... Args>
-void safeCallback(const Callback& callback, const std::string& callbackType, Args&&... args) {
-    try {
-        callback(std::forward<Args>(args)...);
-    } catch (const std::exception& e) {
-        auto now = std::chrono::system_clock::now();
-        auto time_t_now = std::chrono::system_clock::to_time_t(now);
-        std::stringstream ss;
-        ss << std::put_time(std::localtime(&time_t_now), "%Y-%m-%d %H:%M:%S");
-
-        std::cerr << "[" << ss.str() << "] " << callbackType << " 回调函数异常: " << e.what() << std::endl;
-    } catch (...) {
-        auto now = std::chrono::system_clock::now();
-        auto time_t_now = std::chrono::system_clock::to_time_t(now);
-        std::stringstream ss;
-        ss << std::put_time(std::localtime(&time_t_now), "%Y-%m-%d %H:%M:%S");
-
-        std::cerr << "[" << ss.str() << "] " << callbackType << " 回调函数发生未知异常" << std::endl;
-    }
-}
-
 void AsioNetworkModel::onReceive(const boost::system::error_code& error, std::size_t bytes_transferred) {
     if (error) {
         if (error != boost::asio::error::operation_aborted) {
             std::cerr << "接收数据错误: " << error.message() << std::endl;
-            disconnect();
+            connectionLost();
         }
         return;
     }
 
-    // 将接收到的数据追加到缓冲区
-    receive_data_.append(receive_buffer_.data(), bytes_transferred);
+    decoder_.commit(bytes_transferred);
 
-    // 尝试解析消息
+    // 取出本次读取后所有完整的帧，保证粘包的多个响应都不会丢失
     protocol::Serializer serializer;
-    auto message = serializer.deserializeMessage(receive_data_);
-    if (message) {
-        // 清空接收缓冲区
-        receive_data_.clear();
+    protocol::FrameView frame;
+    while (decoder_.nextFrame(frame)) {
+        auto message = serializer.deserializeFrame(frame.header, frame.body, frame.size);
+        if (!message) {
+            continue;
+        }
 
         // 使用 strand 确保回调在同一线程上下文中执行
-        boost::asio::post(strand_, [this, msg = std::move(message)]() mutable {
+        boost::asio::post(strand_, [this, self = shared_from_this(), msg = std::move(message)]() mutable {
+            // 断开连接后不再投递消息
+            if (!connected_) {
+                return;
+            }
+
             safeCallback(
                 [this](std::unique_ptr<protocol::IMessage>& msg) {
                     callback_.onMessageReceived(std::move(msg));
@@ -253,33 +358,20 @@ void AsioNetworkModel::onReceive(const boost::system::error_code& error, std::si
     startReceive();
 }
 
-void AsioNetworkModel::onSend(const boost::system::error_code& error, std::size_t) {
+void AsioNetworkModel::onSend(const boost::system::error_code& error, std::size_t bytes_transferred) {
     if (error) {
         std::cerr << "发送数据错误: " << error.message() << std::endl;
         if (error != boost::asio::error::operation_aborted) {
-            disconnect();
+            connectionLost();
         }
+        return;
     }
-}
 
-void AsioNetworkModel::ioThreadFunc() {
-    try {
-        // 使用 work guard 防止 io_context 在没有任务时退出
-        boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard(io_context_.get_executor());
+    outbound_queue_.completeBatch(bytes_transferred);
 
-        // 运行 io_context，直到显式调用 stop()
-        io_context_.run();
-    } catch (const std::exception& e) {
-        std::cerr << "IO线程异常: " << e.what() << std::endl;
-
-        // 如果发生异常，尝试断开连接
-        if (connected_) {
-            try {
-                disconnect();
-            } catch (...) {
-                // 忽略断开连接时的异常
-            }
-        }
+    // 写操作期间到达的帧聚合为下一次写操作
+    if (!outbound_queue_.empty() && isConnected()) {
+        writeQueued();
     }
 }
 
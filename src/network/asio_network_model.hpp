@@ -1,34 +1,32 @@
 #pragma once
 
 #include "base_network_model.hpp"
+#include "callback_gate.hpp"
 #include "types.h"
+#include "protocol/frame_decoder.hpp"
+#include "outbound_queue.hpp"
+#include "io_context_pool.hpp"
 #include <boost/asio.hpp>
-#include <thread>
-#include <mutex>
-#include <queue>
+#include <memory>
 #include <atomic>
-#include <condition_variable>
 #include <chrono>
 
 namespace network {
 
-// 网络层回调接口
-class INetworkCallback {
-public:
-    virtual ~INetworkCallback() = default;
-    virtual void onMessageReceived(std::unique_ptr<protocol::IMessage> message) = 0;
-};
-
 /**
  * @brief 基于Boost.Asio的网络模型实现
+ *
+ * 运行在共享的 IoContextPool 上，每个连接使用独立的 strand 串行处理。
+ * 异步处理函数持有 shared_from_this()，因此必须通过 std::make_shared 创建。
  */
-class AsioNetworkModel : public BaseNetworkModel {
+class AsioNetworkModel : public BaseNetworkModel, public std::enable_shared_from_this<AsioNetworkModel> {
 public:
     /**
      * @brief 构造函数
      * @param callback 网络回调接口
+     * @param pool 运行本连接的IO线程池
      */
-    explicit AsioNetworkModel(INetworkCallback& callback);
+    AsioNetworkModel(INetworkCallback& callback, std::shared_ptr<IoContextPool> pool);
 
     /**
      * @brief 析构函数
@@ -40,9 +38,21 @@ public:
      * @param host 主机地址
      * @param port 端口号
      * @return 是否连接成功
+     *
+     * 阻塞等待连接完成，不能在IO线程中调用。
      */
     bool connect(const std::string& host, uint16_t port) override;
 
+    /**
+     * @brief 异步连接到服务器
+     * @param host 主机地址
+     * @param port 端口号
+     * @param callback 连接完成后在IO线程中调用
+     *
+     * 域名解析、连接和超时控制都在IO线程中异步完成，调用线程不阻塞。
+     */
+    void connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) override;
+
     /**
      * @brief 断开连接
      */
@@ -61,18 +71,61 @@ public:
      */
     bool sendMessage(const protocol::IMessage& message) override;
 
+    /**
+     * @brief 获取连接统计信息
+     * @return 统计信息快照
+     */
+    robotserver_sdk::ConnectionStatistics getStatistics() const override;
+
+    /**
+     * @brief 断开与上层回调的联系，见 BaseNetworkModel::detachCallback()
+     */
+    void detachCallback() override;
+
+    /**
+     * @brief 获取当前连接的socket文件描述符
+     * @return 文件描述符，未连接时返回-1
+     */
+    int nativeHandle() const override;
+
     /**
      * @brief 设置连接超时时间
      * @param timeout 超时时间（毫秒）
      */
     void setConnectionTimeout(std::chrono::milliseconds timeout);
 
+    /**
+     * @brief 设置连接建立后应用的socket选项
+     * @param options socket选项
+     */
+    void setSocketOptions(const robotserver_sdk::SocketOptions& options);
+
+    /**
+     * @brief 设置发送队列的容量和排队策略
+     * @param options 发送队列配置
+     */
+    void setSendQueueOptions(const robotserver_sdk::SendQueueOptions& options);
+
 private:
+    struct ConnectAttempt;
+
+    /**
+     * @brief 结束一次连接尝试（必须在strand中调用）
+     * @param attempt 连接尝试
+     * @param error 错误码
+     */
+    void finishConnect(const std::shared_ptr<ConnectAttempt>& attempt, boost::system::error_code error);
+
     /**
      * @brief 启动接收循环
      */
     void startReceive();
 
+    /**
+     * @brief 将发送队列中的所有帧聚合为一次写操作（必须在strand中调用）
+     */
+    void writeQueued();
+
     /**
      * @brief 处理接收到的数据
      * @param error 错误码
@@ -88,19 +141,28 @@ private:
     void onSend(const boost::system::error_code& error, std::size_t bytes_transferred);
 
     /**
-     * @brief IO线程函数
+     * @brief 关闭socket（必须在strand中调用）
+     */
+    void closeSocket();
+
+    /**
+     * @brief 收发出错导致连接丢失：关闭socket并通知回调（必须在strand中调用）
      */
-    void ioThreadFunc();
+    void connectionLost();
 
-    boost::asio::io_context io_context_;
-    boost::asio::ip::tcp::socket socket_;
+    std::shared_ptr<IoContextPool> pool_;
+    boost::asio::io_context& io_context_;
+    boost::asio::generic::stream_protocol::socket socket_; // TCP或Unix域socket
     boost::asio::io_context::strand strand_; // 用于序列化异步操作的执行器
-    std::thread io_thread_;
     std::atomic<bool> connected_;
-    std::array<char, 4096> receive_buffer_;
-    INetworkCallback& callback_;
-    std::string receive_data_;
+    std::atomic<int> native_handle_{-1}; // 已连接socket的文件描述符，供其他线程读取
+    bool connecting_ = false; // 是否有连接尝试正在进行，只在strand中访问
+    GatedNetworkCallback callback_; // 经由闸门回调上层
+    protocol::FrameDecoder decoder_; // 流式帧解码器，socket直接读入其环形缓冲区
+    OutboundQueue outbound_queue_; // 发送队列，只在strand中访问
+    std::vector<boost::asio::const_buffer> write_buffers_; // 聚合写的缓冲区序列，复用以避免分配
     std::chrono::milliseconds connection_timeout_{5000}; // 连接超时时间，默认5秒
+    robotserver_sdk::SocketOptions socket_options_; // 连接建立后应用的socket选项
 };
 
 } // namespace network
@@ -1,15 +1,44 @@
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <string>
 #include "protocol/message_interface.hpp"
+#include "types.h"
 
 namespace network {
 
+// 网络层回调接口
+class INetworkCallback {
+public:
+    virtual ~INetworkCallback() = default;
+    virtual void onMessageReceived(std::unique_ptr<protocol::IMessage> message) = 0;
+
+    /**
+     * @brief 连接状态变化通知
+     * @param state 新的连接状态
+     *
+     * 传输层只在连接因收发错误丢失时通知 DISCONNECTED，主动断开不通知。
+     */
+    virtual void onConnectionStateChanged(robotserver_sdk::ConnectionState) {}
+
+    /**
+     * @brief 已接受发送的帧在发送队列中被丢弃或被更新的同类帧取代，不会发出
+     * @param sequenceNumber 帧的序列号
+     */
+    virtual void onSendFailed(uint16_t /*sequenceNumber*/) {}
+};
+
 /**
  * @brief 基础网络模型接口
  */
 class BaseNetworkModel {
 public:
+    /**
+     * @brief 连接结果回调，参数为是否连接成功
+     */
+    using ConnectCallback = std::function<void(bool)>;
+
     virtual ~BaseNetworkModel() = default;
 
     /**
@@ -20,6 +49,21 @@ public:
      */
     virtual bool connect(const std::string& host, uint16_t port) = 0;
 
+    /**
+     * @brief 异步连接到服务器，立即返回
+     * @param host 主机地址
+     * @param port 端口号
+     * @param callback 连接完成（成功、失败或超时）后调用
+     *
+     * 默认实现在调用线程中同步连接后调用回调，支持异步连接的实现应覆盖此方法。
+     */
+    virtual void connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) {
+        bool connected = connect(host, port);
+        if (callback) {
+            callback(connected);
+        }
+    }
+
     /**
      * @brief 断开连接
      */
@@ -37,6 +81,26 @@ public:
      * @return 是否发送成功
      */
     virtual bool sendMessage(const protocol::IMessage& message) = 0;
+
+    /**
+     * @brief 获取连接统计信息
+     * @return 统计信息快照
+     */
+    virtual robotserver_sdk::ConnectionStatistics getStatistics() const = 0;
+
+    /**
+     * @brief 断开与上层回调的联系（上层析构前调用）
+     *
+     * 返回后不再回调上层（包括上层传入的连接结果回调经由的路径），
+     * 其他线程中正在进行的回调结束后才返回；在本对象的回调中调用时不等待当前这一次回调。
+     */
+    virtual void detachCallback() = 0;
+
+    /**
+     * @brief 获取当前连接的socket文件描述符，供调用方加入自己的事件循环
+     * @return 文件描述符，未连接或传输层不由调用方驱动时返回-1
+     */
+    virtual int nativeHandle() const { return -1; }
 };
 
 } // namespace network
@@ -0,0 +1,47 @@
+#include "callback_gate.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace {
+// 当前线程正在其中回调的闸门（嵌套时重复出现），关闭时不等待本线程的回调
+thread_local std::vector<const network::CallbackGate*> entered_gates;
+}  // namespace
+
+namespace network {
+
+bool CallbackGate::enter() {
+    // 先计数再检查关闭标志，与 close()“先置标志再检查计数”配对，不会漏等
+    active_.fetch_add(1, std::memory_order_seq_cst);
+    if (closed_.load(std::memory_order_seq_cst)) {
+        release();
+        return false;
+    }
+    entered_gates.push_back(this);
+    return true;
+}
+
+void CallbackGate::leave() {
+    auto it = std::find(entered_gates.rbegin(), entered_gates.rend(), this);
+    if (it != entered_gates.rend()) {
+        entered_gates.erase(std::next(it).base());
+    }
+    release();
+}
+
+void CallbackGate::release() {
+    active_.fetch_sub(1, std::memory_order_seq_cst);
+    if (closed_.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        idle_.notify_all();
+    }
+}
+
+void CallbackGate::close() {
+    closed_.store(true, std::memory_order_seq_cst);
+
+    int own = static_cast<int>(std::count(entered_gates.begin(), entered_gates.end(), this));
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this, own]() { return active_.load(std::memory_order_seq_cst) <= own; });
+}
+
+} // namespace network
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "base_network_model.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace network {
+
+/**
+ * @brief 下层回调上层的关闭闸门
+ *
+ * 下层在异步处理函数中经由闸门回调上层；上层析构前调用 close()，之后的回调被丢弃，
+ * close() 在条件变量上等待其他线程中正在进行的回调结束。
+ * 在回调中（同一线程）关闭时不等待本线程的那一次回调，由调用方保证回调返回后不再访问上层。
+ * 未关闭时进入和离开只有原子操作，不加锁。
+ */
+class CallbackGate {
+public:
+    CallbackGate() = default;
+    CallbackGate(const CallbackGate&) = delete;
+    CallbackGate& operator=(const CallbackGate&) = delete;
+
+    /**
+     * @brief 进入闸门
+     * @return 是否允许回调，返回 true 时调用方必须随后调用 leave()
+     */
+    bool enter();
+
+    /**
+     * @brief 离开闸门
+     */
+    void leave();
+
+    /**
+     * @brief 关闭闸门并等待其他线程中正在进行的回调结束（任意线程可调用，可重复调用）
+     */
+    void close();
+
+    /**
+     * @brief 闸门打开时执行函数
+     * @param f 函数
+     * @return 是否执行
+     */
+    template <typename F>
+    bool run(F&& f) {
+        if (!enter()) {
+            return false;
+        }
+        try {
+            f();
+        } catch (...) {
+            leave();
+            throw;
+        }
+        leave();
+        return true;
+    }
+
+private:
+    /**
+     * @brief 减少计数，已关闭时唤醒等待的 close()
+     */
+    void release();
+
+    std::atomic<bool> closed_{false};
+    std::atomic<int> active_{0}; // 正在进行的回调数（含嵌套）
+    std::mutex mutex_;
+    std::condition_variable idle_;
+};
+
+/**
+ * @brief 经由闸门转发到上层的网络回调
+ *
+ * 传输层以此代替直接持有上层的 INetworkCallback 引用，上层通过 BaseNetworkModel::detachCallback() 关闭。
+ */
+class GatedNetworkCallback : public INetworkCallback {
+public:
+    explicit GatedNetworkCallback(INetworkCallback& target) : target_(target) {}
+
+    void onMessageReceived(std::unique_ptr<protocol::IMessage> message) override {
+        gate_.run([&]() { target_.onMessageReceived(std::move(message)); });
+    }
+
+    void onConnectionStateChanged(robotserver_sdk::ConnectionState state) override {
+        gate_.run([&]() { target_.onConnectionStateChanged(state); });
+    }
+
+    void onSendFailed(uint16_t sequenceNumber) override {
+        gate_.run([&]() { target_.onSendFailed(sequenceNumber); });
+    }
+
+    /**
+     * @brief 闸门打开时执行其他回调上层的函数（如上层传入的连接结果回调）
+     */
+    template <typename F>
+    bool run(F&& f) {
+        return gate_.run(std::forward<F>(f));
+    }
+
+    /**
+     * @brief 关闭闸门，见 CallbackGate::close()
+     */
+    void close() { gate_.close(); }
+
+private:
+    INetworkCallback& target_;
+    CallbackGate gate_;
+};
+
+} // namespace network
@@ -0,0 +1,163 @@
+#include "dual_connection_network_model.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace network {
+
+using robotserver_sdk::ConnectionChannel;
+using robotserver_sdk::ConnectionState;
+using robotserver_sdk::ConnectionStatistics;
+
+DualConnectionNetworkModel::DualConnectionNetworkModel(INetworkCallback& callback, std::shared_ptr<IoContextPool> pool)
+    : callback_(callback), pool_(std::move(pool)) {
+}
+
+DualConnectionNetworkModel::~DualConnectionNetworkModel() {
+    // 关闭两条连接的回调闸门，等待其他线程中正在回调本对象的处理函数结束
+    if (control_) {
+        control_->detachCallback();
+    }
+    if (data_) {
+        data_->detachCallback();
+    }
+}
+
+void DualConnectionNetworkModel::setTransports(std::shared_ptr<BaseNetworkModel> control,
+                                               std::shared_ptr<BaseNetworkModel> data) {
+    control_ = std::move(control);
+    data_ = std::move(data);
+}
+
+ConnectionChannel DualConnectionNetworkModel::channelFor(protocol::MessageType type) {
+    return type == protocol::MessageType::MOTION_CONTROL_REQ ? ConnectionChannel::CONTROL : ConnectionChannel::DATA;
+}
+
+bool DualConnectionNetworkModel::connect(const std::string& host, uint16_t port) {
+    bool control_connected = control_->connect(host, port);
+    bool data_connected = control_connected && data_->connect(host, port);
+    return finishConnect(control_connected, data_connected);
+}
+
+void DualConnectionNetworkModel::connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) {
+    // 两条连接同时建立，后完成的一方汇总结果
+    struct Pending {
+        std::atomic<int> remaining{2};
+        std::atomic<bool> control_connected{false};
+        std::atomic<bool> data_connected{false};
+        ConnectCallback callback;
+    };
+    auto pending = std::make_shared<Pending>();
+    pending->callback = std::move(callback);
+
+    auto complete = [this, self = shared_from_this(), pending]() {
+        if (pending->remaining.fetch_sub(1) != 1) {
+            return;
+        }
+        bool connected = finishConnect(pending->control_connected, pending->data_connected);
+        if (pending->callback) {
+            // 上层析构后不再回调
+            callback_.run([&]() { pending->callback(connected); });
+        }
+    };
+
+    control_->connectAsync(host, port, [pending, complete](bool connected) {
+        pending->control_connected = connected;
+        complete();
+    });
+    data_->connectAsync(host, port, [pending, complete](bool connected) {
+        pending->data_connected = connected;
+        complete();
+    });
+}
+
+bool DualConnectionNetworkModel::finishConnect(bool control_connected, bool data_connected) {
+    // 连接期间其中一条可能已经丢失，以当前状态为准
+    if (control_connected && data_connected && control_->isConnected() && data_->isConnected()) {
+        connected_ = true;
+        return true;
+    }
+
+    if (control_connected || data_connected) {
+        std::cerr << "连接失败: " << (control_connected ? "数据连接" : "控制连接") << "未能建立" << std::endl;
+    }
+    control_->disconnect();
+    data_->disconnect();
+    return false;
+}
+
+void DualConnectionNetworkModel::disconnect() {
+    connected_ = false;
+    control_->disconnect();
+    data_->disconnect();
+}
+
+bool DualConnectionNetworkModel::isConnected() const {
+    return control_->isConnected() && data_->isConnected();
+}
+
+bool DualConnectionNetworkModel::sendMessage(const protocol::IMessage& message) {
+    if (channelFor(message.getType()) == ConnectionChannel::CONTROL) {
+        return control_->sendMessage(message);
+    }
+    return data_->sendMessage(message);
+}
+
+void DualConnectionNetworkModel::detachCallback() {
+    callback_.close();
+}
+
+ConnectionStatistics DualConnectionNetworkModel::getStatistics() const {
+    ConnectionStatistics control = control_->getStatistics();
+    ConnectionStatistics data = data_->getStatistics();
+
+    ConnectionStatistics stats;
+    stats.framesSent = control.framesSent + data.framesSent;
+    stats.writeOperations = control.writeOperations + data.writeOperations;
+    stats.bytesSent = control.bytesSent + data.bytesSent;
+    stats.maxFramesPerWrite = std::max(control.maxFramesPerWrite, data.maxFramesPerWrite);
+    stats.queueDepth = control.queueDepth + data.queueDepth;
+    stats.maxQueueDepth = std::max(control.maxQueueDepth, data.maxQueueDepth);
+    stats.framesDropped = control.framesDropped + data.framesDropped;
+    stats.framesSuperseded = control.framesSuperseded + data.framesSuperseded;
+    return stats;
+}
+
+ConnectionStatistics DualConnectionNetworkModel::getChannelStatistics(ConnectionChannel channel) const {
+    return channel == ConnectionChannel::CONTROL ? control_->getStatistics() : data_->getStatistics();
+}
+
+int DualConnectionNetworkModel::channelNativeHandle(ConnectionChannel channel) const {
+    return channel == ConnectionChannel::CONTROL ? control_->nativeHandle() : data_->nativeHandle();
+}
+
+void DualConnectionNetworkModel::onMessageReceived(std::unique_ptr<protocol::IMessage> message) {
+    // 回调期间保持本对象存活，析构已开始时丢弃
+    auto self = weak_from_this().lock();
+    if (!self) {
+        return;
+    }
+    callback_.onMessageReceived(std::move(message));
+}
+
+void DualConnectionNetworkModel::onSendFailed(uint16_t sequenceNumber) {
+    auto self = weak_from_this().lock();
+    if (!self) {
+        return;
+    }
+    callback_.onSendFailed(sequenceNumber);
+}
+
+void DualConnectionNetworkModel::onConnectionStateChanged(ConnectionState state) {
+    // 传输层只报告连接丢失；两条连接先后丢失或主动断开后只通知一次
+    auto self = weak_from_this().lock();
+    if (state != ConnectionState::DISCONNECTED || !self || !connected_.exchange(false)) {
+        return;
+    }
+
+    // 只剩一条连接时无法正常工作，断开另一条后由上层统一重连
+    control_->disconnect();
+    data_->disconnect();
+    callback_.onConnectionStateChanged(ConnectionState::DISCONNECTED);
+}
+
+} // namespace network
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "base_network_model.hpp"
+#include "callback_gate.hpp"
+#include "io_context_pool.hpp"
+#include "types.h"
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace network {
+
+/**
+ * @brief 双连接传输
+ *
+ * 向同一个RobotServer建立两条连接：控制连接只发送运动控制命令（request2_*），
+ * 数据连接发送状态查询和导航任务。两条连接各有独立的发送队列和socket缓冲区，
+ * 遥测轮询和大的导航任务不会阻塞运动控制命令。
+ *
+ * 对上层表现为一条连接：两条连接都建立后才算连接成功，任一条丢失时另一条一并断开，
+ * 由外层的 ReconnectingNetworkModel 统一重连。
+ * 异步处理函数持有 shared_from_this()，因此必须通过 std::make_shared 创建，
+ * 并在构造后调用 setTransports() 设置两条连接的传输层。
+ */
+class DualConnectionNetworkModel : public BaseNetworkModel,
+                                   public INetworkCallback,
+                                   public std::enable_shared_from_this<DualConnectionNetworkModel> {
+public:
+    /**
+     * @brief 构造函数
+     * @param callback 上层回调接口
+     * @param pool IO线程池，析构时用于判断是否在IO线程中
+     */
+    DualConnectionNetworkModel(INetworkCallback& callback, std::shared_ptr<IoContextPool> pool);
+
+    /**
+     * @brief 析构函数，等待两条连接的异步处理函数全部结束
+     */
+    ~DualConnectionNetworkModel() override;
+
+    /**
+     * @brief 设置两条连接的传输层，其回调接口必须为本对象
+     * @param control 控制连接
+     * @param data 数据连接
+     */
+    void setTransports(std::shared_ptr<BaseNetworkModel> control, std::shared_ptr<BaseNetworkModel> data);
+
+    /**
+     * @brief 消息使用的连接通道
+     * @param type 请求消息类型
+     * @return 运动控制命令为 CONTROL，其余为 DATA
+     */
+    static robotserver_sdk::ConnectionChannel channelFor(protocol::MessageType type);
+
+    bool connect(const std::string& host, uint16_t port) override;
+    void connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) override;
+    void disconnect() override;
+    bool isConnected() const override;
+
+    /**
+     * @brief 按消息类型选择连接发送
+     */
+    bool sendMessage(const protocol::IMessage& message) override;
+
+    /**
+     * @brief 获取两条连接合计的统计信息
+     */
+    robotserver_sdk::ConnectionStatistics getStatistics() const override;
+
+    /**
+     * @brief 断开与上层回调的联系，见 BaseNetworkModel::detachCallback()
+     */
+    void detachCallback() override;
+
+    /**
+     * @brief 获取一条连接的统计信息
+     * @param channel 连接通道
+     * @return 统计信息快照
+     */
+    robotserver_sdk::ConnectionStatistics getChannelStatistics(robotserver_sdk::ConnectionChannel channel) const;
+
+    /**
+     * @brief 获取一条连接的socket文件描述符
+     * @param channel 连接通道
+     * @return 文件描述符，未连接时返回-1
+     */
+    int channelNativeHandle(robotserver_sdk::ConnectionChannel channel) const;
+
+    // INetworkCallback，由两条连接的传输层调用
+    void onMessageReceived(std::unique_ptr<protocol::IMessage> message) override;
+    void onConnectionStateChanged(robotserver_sdk::ConnectionState state) override;
+    void onSendFailed(uint16_t sequenceNumber) override;
+
+private:
+    /**
+     * @brief 两条连接都完成后的处理，一条失败时断开另一条
+     * @return 两条连接是否都已建立
+     */
+    bool finishConnect(bool control_connected, bool data_connected);
+
+    GatedNetworkCallback callback_; // 经由闸门回调上层
+    std::shared_ptr<IoContextPool> pool_;
+    std::shared_ptr<BaseNetworkModel> control_;
+    std::shared_ptr<BaseNetworkModel> data_;
+
+    // 两条连接都建立后为true，第一次连接丢失时清零，保证只向上层通知一次
+    std::atomic<bool> connected_{false};
+};
+
+} // namespace network
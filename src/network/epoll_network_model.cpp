@@ -0,0 +1,433 @@
+#include "epoll_network_model.hpp"
+#include "protocol/serializer.hpp"
+#include "safe_callback.hpp"
+#include "socket_address.hpp"
+#include "socket_options.hpp"
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <climits>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <iostream>
+
+namespace {
+
+// 单次 EPOLLIN 最多读取的次数，避免一个连接长时间占用事件循环
+constexpr int MAX_READS_PER_EVENT = 16;
+
+// 单次 writev 最多的缓冲区个数
+constexpr std::size_t MAX_IOV = IOV_MAX;
+
+// 距截止时间的剩余时长（向上取整到毫秒），已过截止时间时为0
+std::chrono::milliseconds remainingUntil(std::chrono::steady_clock::time_point deadline) {
+    auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+    return std::max(remaining, std::chrono::milliseconds(0));
+}
+
+}  // namespace
+
+namespace network {
+
+EpollNetworkModel::EpollNetworkModel(INetworkCallback& callback, std::shared_ptr<EpollReactor> reactor,
+                                      std::shared_ptr<HostResolver> resolver)
+    : callback_(callback), reactor_(std::move(reactor)), resolver_(std::move(resolver)) {
+}
+
+EpollNetworkModel::~EpollNetworkModel() {
+    // 正常情况下描述符已在事件循环中关闭并注销
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void EpollNetworkModel::setConnectionTimeout(std::chrono::milliseconds timeout) {
+    connection_timeout_ = timeout;
+}
+
+void EpollNetworkModel::setSocketOptions(const robotserver_sdk::SocketOptions& options) {
+    socket_options_ = options;
+}
+
+void EpollNetworkModel::setSendQueueOptions(const robotserver_sdk::SendQueueOptions& options) {
+    outbound_queue_.setOptions(options);
+}
+
+bool EpollNetworkModel::connect(const std::string& host, uint16_t port) {
+    // 如果已经连接，直接返回成功
+    if (connected_) {
+        return true;
+    }
+
+    // 在事件循环线程中同步等待连接完成会导致死锁
+    if (reactor_->runningInThisThread()) {
+        std::cerr << "连接失败: 不能在IO线程中同步连接" << std::endl;
+        return false;
+    }
+
+    auto result = std::make_shared<std::promise<bool>>();
+    std::future<bool> result_future = result->get_future();
+    connectAsync(host, port, [result](bool connected) {
+        result->set_value(connected);
+    });
+
+    return result_future.get();
+}
+
+void EpollNetworkModel::connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) {
+    // 超时时间覆盖地址解析和连接两个阶段
+    auto deadline = std::chrono::steady_clock::now() + connection_timeout_;
+    auto resolve = std::make_shared<PendingResolve>();
+    resolve->callback = std::move(callback);
+
+    reactor_->post([this, self = shared_from_this(), host, port, deadline, resolve]() {
+        // 主机名在解析线程中查询DNS，超时先到时取消解析并以失败结束
+        resolve->timer = reactor_->runAfter(remainingUntil(deadline), [resolver = resolver_, resolve]() {
+            resolve->done = true;
+            resolver->cancel(resolve->request);
+            std::cerr << "连接失败: 地址解析超时" << std::endl;
+            if (resolve->callback) {
+                safeCallback(resolve->callback, "连接结果", false);
+            }
+        });
+
+        // 解析线程只持有弱引用：连接对象析构或超时后排队的结果被丢弃
+        auto callback = [weak = std::weak_ptr<EpollNetworkModel>(self), pending = std::weak_ptr<PendingResolve>(resolve),
+                         deadline](bool resolved, const sockaddr_storage& address, socklen_t length) {
+            auto self = weak.lock();
+            auto resolve = pending.lock();
+            if (!self || !resolve) {
+                return;
+            }
+            self->reactor_->post([self, deadline, resolve, resolved, address, length]() {
+                if (resolve->done) {
+                    return;
+                }
+                resolve->done = true;
+                self->reactor_->cancelTimer(resolve->timer);
+
+                if (!resolved) {
+                    if (resolve->callback) {
+                        safeCallback(resolve->callback, "连接结果", false);
+                    }
+                    return;
+                }
+                self->startConnect(address, length, std::move(resolve->callback), deadline);
+            });
+        };
+        resolve->request = resolveEndpointAsync(*resolver_, host, port, std::move(callback));
+    });
+}
+
+void EpollNetworkModel::startConnect(const sockaddr_storage& address, socklen_t length, ConnectCallback callback,
+                                     std::chrono::steady_clock::time_point deadline) {
+    // 如果已经连接，直接返回成功；同一连接同时只允许一个连接尝试
+    if (connected_ || connecting_) {
+        if (connecting_) {
+            std::cerr << "连接失败: 已有连接尝试正在进行" << std::endl;
+        }
+        if (callback) {
+            safeCallback(callback, "连接结果", static_cast<bool>(connected_));
+        }
+        return;
+    }
+
+    // 清空上一次连接残留的收发状态
+    closeSocket();
+    decoder_.reset();
+
+    fd_ = ::socket(address.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) {
+        std::cerr << "连接失败: 创建socket失败: " << std::strerror(errno) << std::endl;
+        if (callback) {
+            safeCallback(callback, "连接结果", false);
+        }
+        return;
+    }
+
+    connecting_ = true;
+    connect_callback_ = std::move(callback);
+
+    int rc = ::connect(fd_, reinterpret_cast<const sockaddr*>(&address), length);
+    if (rc != 0 && errno != EINPROGRESS) {
+        finishConnect(errno);
+        return;
+    }
+
+    // 非阻塞连接完成时socket变为可写
+    if (!reactor_->add(fd_, EPOLLOUT, shared_from_this())) {
+        finishConnect(EIO);
+        return;
+    }
+
+    connect_timer_ = reactor_->runAfter(remainingUntil(deadline), [this, self = shared_from_this()]() {
+        connect_timer_ = 0;
+        if (connecting_) {
+            finishConnect(ETIMEDOUT);
+        }
+    });
+}
+
+void EpollNetworkModel::finishConnect(int error) {
+    connecting_ = false;
+    if (connect_timer_ != 0) {
+        reactor_->cancelTimer(connect_timer_);
+        connect_timer_ = 0;
+    }
+    ConnectCallback callback = std::move(connect_callback_);
+    connect_callback_ = nullptr;
+
+    if (error == 0 && !reactor_->modify(fd_, EPOLLIN)) {
+        error = EIO;
+    }
+
+    if (error != 0) {
+        std::cerr << "连接失败: " << std::strerror(error) << std::endl;
+        closeSocket();
+    } else {
+        // 连接成功，设置socket选项后开始接收
+        applySocketOptions(fd_, socket_options_);
+        connected_ = true;
+    }
+
+    if (callback) {
+        safeCallback(callback, "连接结果", error == 0);
+    }
+}
+
+void EpollNetworkModel::disconnect() {
+    try {
+        // 已在事件循环线程中（如回调里），直接关闭
+        if (reactor_->runningInThisThread()) {
+            closeSocket();
+            return;
+        }
+
+        auto closed = std::make_shared<std::promise<void>>();
+        std::future<void> closed_future = closed->get_future();
+        reactor_->post([this, self = shared_from_this(), closed]() {
+            closeSocket();
+            closed->set_value();
+        });
+        closed_future.wait();
+    } catch (const std::exception& e) {
+        std::cerr << "断开连接异常: " << e.what() << std::endl;
+    }
+}
+
+void EpollNetworkModel::closeSocket() {
+    connected_ = false;
+
+    if (fd_ >= 0) {
+        reactor_->remove(fd_);
+        ::close(fd_);
+        fd_ = -1;
+    }
+
+    outbound_queue_.clear();
+    batch_bytes_ = 0;
+    batch_written_ = 0;
+    want_write_ = false;
+
+    // 连接尝试进行中被断开，以失败结束
+    if (connecting_) {
+        connecting_ = false;
+        if (connect_timer_ != 0) {
+            reactor_->cancelTimer(connect_timer_);
+            connect_timer_ = 0;
+        }
+        ConnectCallback callback = std::move(connect_callback_);
+        connect_callback_ = nullptr;
+        if (callback) {
+            safeCallback(callback, "连接结果", false);
+        }
+    }
+}
+
+void EpollNetworkModel::connectionLost(const char* reason) {
+    // 已经关闭时不重复通知
+    if (!connected_) {
+        return;
+    }
+    std::cerr << reason << std::endl;
+    closeSocket();
+
+    safeCallback(
+        [this]() {
+            callback_.onConnectionStateChanged(robotserver_sdk::ConnectionState::DISCONNECTED);
+        },
+        "连接状态变化"
+    );
+}
+
+bool EpollNetworkModel::isConnected() const {
+    return connected_;
+}
+
+bool EpollNetworkModel::sendMessage(const protocol::IMessage& message) {
+    if (!isConnected()) {
+        return false;
+    }
+
+    try {
+        // 序列化消息，协议头和消息体分开存放，避免拼接拷贝；消息体复用已写出帧的缓冲区
+        protocol::Serializer serializer;
+        protocol::SerializedFrame frame;
+        frame.body = outbound_queue_.acquireBody();
+        serializer.serializeFrame(message, frame);
+
+        reactor_->post([this, self = shared_from_this(), frame = std::move(frame)]() mutable {
+            if (!isConnected()) {
+                return;
+            }
+
+            if (auto dropped = outbound_queue_.push(std::move(frame))) {
+                safeCallback(
+                    [this](uint16_t sequence) {
+                        callback_.onSendFailed(sequence);
+                    },
+                    "发送失败",
+                    *dropped
+                );
+            }
+
+            // 同一轮投递的帧在本轮结束时聚合写出
+            if (!flush_scheduled_ && !outbound_queue_.writeInProgress()) {
+                flush_scheduled_ = true;
+                reactor_->defer([this, self = shared_from_this()]() {
+                    flush_scheduled_ = false;
+                    flush();
+                });
+            }
+        });
+
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "发送消息异常: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void EpollNetworkModel::detachCallback() {
+    callback_.close();
+}
+
+robotserver_sdk::ConnectionStatistics EpollNetworkModel::getStatistics() const {
+    robotserver_sdk::ConnectionStatistics stats;
+    outbound_queue_.fillStatistics(stats);
+    return stats;
+}
+
+void EpollNetworkModel::onEvents(uint32_t events) {
+    if (connecting_) {
+        int error = 0;
+        socklen_t length = sizeof(error);
+        if (getsockopt(fd_, SOL_SOCKET, SO_ERROR, &error, &length) != 0) {
+            error = errno;
+        }
+        finishConnect(error);
+        return;
+    }
+
+    if (events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+        handleReadable();
+    }
+    if ((events & EPOLLOUT) && isConnected()) {
+        flush();
+    }
+}
+
+void EpollNetworkModel::handleReadable() {
+    protocol::Serializer serializer;
+
+    for (int i = 0; i < MAX_READS_PER_EVENT && isConnected(); ++i) {
+        // 直接读入帧解码器的环形缓冲区，避免额外拷贝
+        std::size_t writable = 0;
+        char* buffer = decoder_.prepare(writable);
+        ssize_t received = ::recv(fd_, buffer, writable, 0);
+        if (received == 0) {
+            connectionLost("接收数据错误: 连接被对端关闭");
+            return;
+        }
+        if (received < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                std::string reason = std::string("接收数据错误: ") + std::strerror(errno);
+                connectionLost(reason.c_str());
+            }
+            return;
+        }
+        decoder_.commit(static_cast<std::size_t>(received));
+
+        // 取出所有完整的帧，回调中可能断开连接
+        protocol::FrameView frame;
+        while (isConnected() && decoder_.nextFrame(frame)) {
+            auto message = serializer.deserializeFrame(frame.header, frame.body, frame.size);
+            if (!message) {
+                continue;
+            }
+            safeCallback(
+                [this](std::unique_ptr<protocol::IMessage>& msg) {
+                    callback_.onMessageReceived(std::move(msg));
+                },
+                "网络消息接收",
+                message
+            );
+        }
+
+        // 没有读满说明内核缓冲区已空
+        if (static_cast<std::size_t>(received) < writable) {
+            return;
+        }
+    }
+}
+
+void EpollNetworkModel::flush() {
+    while (isConnected()) {
+        if (!outbound_queue_.writeInProgress()) {
+            if (outbound_queue_.empty()) {
+                break;
+            }
+            // 排队帧（优先通道在前）聚合为一次写操作
+            outbound_queue_.beginBatch();
+            batch_bytes_ = outbound_queue_.batchBytes();
+            batch_written_ = 0;
+        }
+
+        // 跳过已写出的部分，构造剩余数据的缓冲区序列
+        outbound_queue_.gatherBatch(batch_written_, MAX_IOV, iov_);
+
+        msghdr msg{};
+        msg.msg_iov = iov_.data();
+        msg.msg_iovlen = iov_.size();
+        ssize_t written = ::sendmsg(fd_, &msg, MSG_NOSIGNAL);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            std::string reason = std::string("发送数据错误: ") + std::strerror(errno);
+            connectionLost(reason.c_str());
+            return;
+        }
+
+        batch_written_ += static_cast<std::size_t>(written);
+        if (batch_written_ == batch_bytes_) {
+            outbound_queue_.completeBatch(batch_bytes_);
+        }
+    }
+
+    // 内核发送缓冲区满时等待可写事件
+    bool want_write = isConnected() && outbound_queue_.writeInProgress();
+    if (want_write != want_write_ && fd_ >= 0) {
+        want_write_ = want_write;
+        reactor_->modify(fd_, want_write ? (EPOLLIN | EPOLLOUT) : EPOLLIN);
+    }
+}
+
+} // namespace network
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "base_network_model.hpp"
+#include "callback_gate.hpp"
+#include "host_resolver.hpp"
+#include "epoll_reactor.hpp"
+#include "outbound_queue.hpp"
+#include "protocol/frame_decoder.hpp"
+#include "types.h"
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace network {
+
+/**
+ * @brief 基于epoll的网络模型实现，不依赖Boost.Asio
+ *
+ * 所有连接共享一个单线程的 EpollReactor，连接状态只在循环线程中访问，
+ * 因此不需要strand或锁；其他线程的发送请求通过 EpollReactor::post 投递，
+ * 同一轮中投递的多个帧聚合为一次 writev。
+ * 帧解码和发送队列与 AsioNetworkModel 共用 FrameDecoder / OutboundQueue。
+ * 必须通过 std::make_shared 创建。
+ */
+class EpollNetworkModel : public BaseNetworkModel,
+                          public EpollReactor::Handler,
+                          public std::enable_shared_from_this<EpollNetworkModel> {
+public:
+    /**
+     * @brief 构造函数
+     * @param callback 网络回调接口
+     * @param reactor 运行本连接的事件循环
+     * @param resolver 查询主机名的解析线程
+     */
+    EpollNetworkModel(INetworkCallback& callback, std::shared_ptr<EpollReactor> reactor,
+                      std::shared_ptr<HostResolver> resolver);
+
+    /**
+     * @brief 析构函数
+     */
+    ~EpollNetworkModel() override;
+
+    /**
+     * @brief 连接到服务器
+     * @param host 主机地址
+     * @param port 端口号
+     * @return 是否连接成功
+     *
+     * 阻塞等待连接完成，不能在事件循环线程中调用。
+     */
+    bool connect(const std::string& host, uint16_t port) override;
+
+    /**
+     * @brief 异步连接到服务器
+     * @param host 主机地址
+     * @param port 端口号
+     * @param callback 连接完成后在事件循环线程中调用
+     *
+     * IP地址不涉及DNS查询，主机名在运行时共享的解析线程中查询DNS；连接超时覆盖解析和连接两个阶段，
+     * 非阻塞连接和超时控制在事件循环中完成，调用线程不会阻塞。
+     */
+    void connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) override;
+
+    /**
+     * @brief 断开连接
+     */
+    void disconnect() override;
+
+    /**
+     * @brief 检查是否已连接
+     * @return 是否已连接
+     */
+    bool isConnected() const override;
+
+    /**
+     * @brief 发送消息
+     * @param message 要发送的消息
+     * @return 是否发送成功
+     */
+    bool sendMessage(const protocol::IMessage& message) override;
+
+    /**
+     * @brief 获取连接统计信息
+     * @return 统计信息快照
+     */
+    robotserver_sdk::ConnectionStatistics getStatistics() const override;
+
+    /**
+     * @brief 断开与上层回调的联系，见 BaseNetworkModel::detachCallback()
+     */
+    void detachCallback() override;
+
+    /**
+     * @brief 设置连接超时时间
+     * @param timeout 超时时间（毫秒）
+     */
+    void setConnectionTimeout(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief 设置连接建立后应用的socket选项
+     * @param options socket选项
+     */
+    void setSocketOptions(const robotserver_sdk::SocketOptions& options);
+
+    /**
+     * @brief 设置发送队列的容量和排队策略
+     * @param options 发送队列配置
+     */
+    void setSendQueueOptions(const robotserver_sdk::SendQueueOptions& options);
+
+    /**
+     * @brief 描述符就绪（在事件循环线程中调用）
+     * @param events epoll事件位
+     */
+    void onEvents(uint32_t events) override;
+
+private:
+    /**
+     * @brief 一次地址解析的状态，由解析完成和超时两个任务共享（只在事件循环线程中访问）
+     */
+    struct PendingResolve {
+        ConnectCallback callback;
+        EpollReactor::TimerId timer = 0;
+        HostResolver::RequestId request = 0; // 解析线程中的请求，超时时取消
+        bool done = false;
+    };
+
+    /**
+     * @brief 在事件循环中发起非阻塞连接
+     * @param deadline 连接尝试的截止时间
+     */
+    void startConnect(const sockaddr_storage& address, socklen_t length, ConnectCallback callback,
+                      std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * @brief 结束一次连接尝试
+     * @param error 0表示成功，否则为errno
+     */
+    void finishConnect(int error);
+
+    /**
+     * @brief 读取所有可读数据并分发完整的帧
+     */
+    void handleReadable();
+
+    /**
+     * @brief 尽可能多地写出发送队列中的帧，写不完时关注EPOLLOUT
+     */
+    void flush();
+
+    /**
+     * @brief 关闭socket并结束进行中的连接尝试
+     */
+    void closeSocket();
+
+    /**
+     * @brief 收发出错导致连接丢失：关闭socket并通知回调
+     * @param reason 日志中的原因
+     */
+    void connectionLost(const char* reason);
+
+    GatedNetworkCallback callback_; // 经由闸门回调上层
+    std::shared_ptr<EpollReactor> reactor_;
+    std::shared_ptr<HostResolver> resolver_;
+    std::chrono::milliseconds connection_timeout_{5000}; // 连接超时时间，默认5秒
+    robotserver_sdk::SocketOptions socket_options_; // 连接建立后应用的socket选项
+    std::atomic<bool> connected_{false};
+
+    // 以下成员只在事件循环线程中访问
+    int fd_ = -1;
+    bool connecting_ = false;
+    ConnectCallback connect_callback_;
+    EpollReactor::TimerId connect_timer_ = 0;
+    bool want_write_ = false;      // 是否关注EPOLLOUT
+    bool flush_scheduled_ = false; // 本轮结束时是否已安排写出
+    protocol::FrameDecoder decoder_;
+    OutboundQueue outbound_queue_;
+    std::size_t batch_bytes_ = 0;   // 批次总字节数
+    std::size_t batch_written_ = 0; // 批次已写出的字节数
+    std::vector<iovec> iov_;        // writev 的缓冲区序列，复用以避免分配
+};
+
+} // namespace network
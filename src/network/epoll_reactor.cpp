@@ -0,0 +1,171 @@
+#include "epoll_reactor.hpp"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <system_error>
+
+namespace {
+// 当前线程所属事件循环的共享状态
+thread_local const void* current_reactor = nullptr;
+
+// 单次 epoll_wait 最多取出的事件数
+constexpr int MAX_EVENTS = 64;
+}  // namespace
+
+namespace network {
+
+EpollReactor::State::State(std::chrono::microseconds spin_duration) : spin(spin_duration) {
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "epoll_create1");
+    }
+
+    wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeup_fd < 0) {
+        int error = errno;
+        ::close(epoll_fd);
+        throw std::system_error(error, std::generic_category(), "eventfd");
+    }
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = wakeup_fd;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wakeup_fd, &event);
+}
+
+EpollReactor::State::~State() {
+    ::close(wakeup_fd);
+    ::close(epoll_fd);
+}
+
+EpollReactor::EpollReactor(std::chrono::microseconds spin, const std::shared_ptr<ThreadConfigurator>& threads)
+    : state_(std::make_shared<State>(spin)),
+      thread_([state = state_]() { run(*state); }) {
+    if (threads) {
+        threads->apply(thread_, "epoll");
+    }
+}
+
+EpollReactor::~EpollReactor() {
+    state_->stopped = true;
+    uint64_t one = 1;
+    ssize_t ignored = ::write(state_->wakeup_fd, &one, sizeof(one));
+    (void)ignored;
+
+    if (thread_.joinable()) {
+        // 最后一个引用在循环线程自己的任务中释放时不能join自身；
+        // 线程持有共享状态，本轮处理完后发现已停止而退出，描述符随共享状态一起关闭
+        if (thread_.get_id() == std::this_thread::get_id()) {
+            thread_.detach();
+        } else {
+            thread_.join();
+        }
+    }
+}
+
+void EpollReactor::post(Task task) {
+    // 队列中已有任务时循环线程必然会被唤醒，不重复写eventfd
+    if (state_->scheduler.post(std::move(task))) {
+        uint64_t one = 1;
+        ssize_t ignored = ::write(state_->wakeup_fd, &one, sizeof(one));
+        (void)ignored;
+    }
+}
+
+void EpollReactor::defer(Task task) {
+    state_->scheduler.defer(std::move(task));
+}
+
+bool EpollReactor::runningInThisThread() const {
+    return current_reactor == state_.get();
+}
+
+bool EpollReactor::add(int fd, uint32_t events, std::shared_ptr<Handler> handler) {
+    epoll_event event{};
+    event.events = events;
+    event.data.fd = fd;
+    if (epoll_ctl(state_->epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        std::cerr << "epoll注册失败: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    state_->handlers[fd] = std::move(handler);
+    return true;
+}
+
+bool EpollReactor::modify(int fd, uint32_t events) {
+    epoll_event event{};
+    event.events = events;
+    event.data.fd = fd;
+    if (epoll_ctl(state_->epoll_fd, EPOLL_CTL_MOD, fd, &event) != 0) {
+        std::cerr << "epoll修改失败: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void EpollReactor::remove(int fd) {
+    epoll_ctl(state_->epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+    state_->handlers.erase(fd);
+}
+
+EpollReactor::TimerId EpollReactor::runAfter(std::chrono::milliseconds delay, Task task) {
+    return state_->scheduler.runAfter(delay, std::move(task));
+}
+
+void EpollReactor::cancelTimer(TimerId id) {
+    state_->scheduler.cancelTimer(id);
+}
+
+void EpollReactor::run(State& state) {
+    current_reactor = &state;
+    epoll_event events[MAX_EVENTS];
+
+    while (!state.stopped) {
+        int timeout = state.spin.waitTimeout(state.scheduler.runExpiredTimers());
+        int count = epoll_wait(state.epoll_fd, events, MAX_EVENTS, timeout);
+        if (count < 0) {
+            if (errno != EINTR) {
+                std::cerr << "epoll_wait错误: " << std::strerror(errno) << std::endl;
+            }
+            continue;
+        }
+        if (count > 0) {
+            state.spin.onActivity();
+        } else if (timeout == 0) {
+            state.spin.relax();
+        }
+
+        for (int i = 0; i < count; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == state.wakeup_fd) {
+                uint64_t value = 0;
+                ssize_t ignored = ::read(state.wakeup_fd, &value, sizeof(value));
+                (void)ignored;
+                continue;
+            }
+
+            // 同一批事件中前面的处理可能已注销该描述符
+            auto it = state.handlers.find(fd);
+            if (it == state.handlers.end()) {
+                continue;
+            }
+            std::shared_ptr<Handler> handler = it->second;
+
+            // 单个处理函数抛出的异常不应终止事件循环
+            try {
+                handler->onEvents(events[i].events);
+            } catch (const std::exception& e) {
+                std::cerr << "epoll事件处理异常: " << e.what() << std::endl;
+            } catch (...) {
+                std::cerr << "epoll事件处理未知异常" << std::endl;
+            }
+        }
+
+        state.scheduler.runTasks();
+    }
+}
+
+} // namespace network
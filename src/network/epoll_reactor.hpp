@@ -0,0 +1,136 @@
+#pragma once
+
+#include "loop_scheduler.hpp"
+#include "spin_then_park.hpp"
+#include "thread_settings.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+namespace network {
+
+/**
+ * @brief 基于epoll的单线程事件循环
+ *
+ * 一个线程运行 epoll_wait，处理已注册描述符的就绪事件、其他线程投递的任务和定时器。
+ * 所有注册、定时器操作和事件处理都在循环线程中进行，因此连接不需要额外的锁或strand；
+ * 跨线程投递通过 eventfd 唤醒，队列已有任务时不重复唤醒。
+ */
+class EpollReactor {
+public:
+    using Task = LoopScheduler::Task;
+    using TimerId = LoopScheduler::TimerId;
+
+    /**
+     * @brief 描述符事件处理接口
+     */
+    class Handler {
+    public:
+        virtual ~Handler() = default;
+
+        /**
+         * @brief 描述符就绪（在循环线程中调用）
+         * @param events epoll事件位（EPOLLIN / EPOLLOUT / EPOLLERR / EPOLLHUP）
+         */
+        virtual void onEvents(uint32_t events) = 0;
+    };
+
+    /**
+     * @brief 构造函数，创建epoll实例并启动循环线程
+     * @param spin 忙轮询的自旋时长，0表示不忙轮询
+     * @param threads 线程配置，为空时使用默认属性
+     * @throws std::system_error 创建epoll或eventfd失败
+     */
+    explicit EpollReactor(std::chrono::microseconds spin = std::chrono::microseconds(0),
+                          const std::shared_ptr<ThreadConfigurator>& threads = nullptr);
+
+    /**
+     * @brief 析构函数，停止并等待循环线程
+     */
+    ~EpollReactor();
+
+    EpollReactor(const EpollReactor&) = delete;
+    EpollReactor& operator=(const EpollReactor&) = delete;
+
+    /**
+     * @brief 投递任务到循环线程执行（任意线程可调用）
+     * @param task 任务
+     */
+    void post(Task task);
+
+    /**
+     * @brief 延后到本轮事件和任务处理完之后执行（必须在循环线程中调用）
+     * @param task 任务
+     *
+     * 用于把同一轮中产生的多个操作合并处理，例如把多个发送请求聚合为一次写操作，
+     * 不需要再经过eventfd唤醒。
+     */
+    void defer(Task task);
+
+    /**
+     * @brief 当前线程是否为循环线程
+     */
+    bool runningInThisThread() const;
+
+    /**
+     * @brief 注册描述符（必须在循环线程中调用）
+     * @param fd 描述符
+     * @param events 关注的事件
+     * @param handler 事件处理者，注册期间由事件循环持有
+     * @return 是否成功
+     */
+    bool add(int fd, uint32_t events, std::shared_ptr<Handler> handler);
+
+    /**
+     * @brief 修改关注的事件（必须在循环线程中调用）
+     */
+    bool modify(int fd, uint32_t events);
+
+    /**
+     * @brief 注销描述符并释放事件处理者（必须在循环线程中调用）
+     */
+    void remove(int fd);
+
+    /**
+     * @brief 启动定时器（必须在循环线程中调用）
+     * @param delay 延迟
+     * @param task 到期后执行的任务
+     * @return 定时器编号
+     */
+    TimerId runAfter(std::chrono::milliseconds delay, Task task);
+
+    /**
+     * @brief 取消尚未到期的定时器（必须在循环线程中调用）
+     */
+    void cancelTimer(TimerId id);
+
+private:
+    // 循环线程与本对象共享，本对象在循环线程中析构时线程分离后仍可安全访问
+    struct State {
+        explicit State(std::chrono::microseconds spin_duration);
+        ~State();
+
+        int epoll_fd = -1;
+        int wakeup_fd = -1; // eventfd，用于跨线程唤醒
+        std::atomic<bool> stopped{false};
+
+        LoopScheduler scheduler;
+        SpinThenPark spin; // 只在循环线程中访问
+
+        // 只在循环线程中访问
+        std::unordered_map<int, std::shared_ptr<Handler>> handlers;
+    };
+
+    /**
+     * @brief 线程函数
+     */
+    static void run(State& state);
+
+    std::shared_ptr<State> state_;
+    std::thread thread_;
+};
+
+} // namespace network
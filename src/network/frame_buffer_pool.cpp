@@ -0,0 +1,33 @@
+#include "frame_buffer_pool.hpp"
+
+namespace network {
+
+FrameBufferPool::FrameBufferPool(std::size_t max_buffers, std::size_t max_capacity)
+    : max_buffers_(max_buffers), max_capacity_(max_capacity) {
+    buffers_.reserve(max_buffers_);
+}
+
+std::string FrameBufferPool::acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffers_.empty()) {
+        return std::string();
+    }
+    std::string buffer = std::move(buffers_.back());
+    buffers_.pop_back();
+    return buffer;
+}
+
+void FrameBufferPool::release(std::string&& buffer) {
+    // 容量没有超出短字符串内部缓冲区的不值得保留
+    if (buffer.capacity() <= std::string().capacity() || buffer.capacity() > max_capacity_) {
+        return;
+    }
+    buffer.clear();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffers_.size() < max_buffers_) {
+        buffers_.push_back(std::move(buffer));
+    }
+}
+
+} // namespace network
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace network {
+
+/**
+ * @brief 消息体缓冲区池
+ *
+ * 发送线程从池中取出缓冲区序列化消息体，帧写出（或被丢弃、被取代）后缓冲区连同容量归还到池中，
+ * 稳定运行时序列化和入队不再分配内存。
+ * 池中的缓冲区数和单个缓冲区的容量都有上限，超出的缓冲区直接释放，偶发的大消息不会让池长期占用内存。
+ * 线程安全：acquire() 和 release() 可在任意线程调用。
+ */
+class FrameBufferPool {
+public:
+    /**
+     * @brief 构造函数
+     * @param max_buffers 池中最多保留的缓冲区数
+     * @param max_capacity 单个缓冲区保留的最大容量（字节），容量更大的缓冲区归还时释放
+     */
+    explicit FrameBufferPool(std::size_t max_buffers = 64, std::size_t max_capacity = 256 * 1024);
+
+    FrameBufferPool(const FrameBufferPool&) = delete;
+    FrameBufferPool& operator=(const FrameBufferPool&) = delete;
+
+    /**
+     * @brief 取出一个空缓冲区
+     * @return 空缓冲区，池为空时返回新的空字符串
+     */
+    std::string acquire();
+
+    /**
+     * @brief 归还缓冲区
+     * @param buffer 不再使用的缓冲区，内容被清空，容量保留
+     */
+    void release(std::string&& buffer);
+
+private:
+    const std::size_t max_buffers_;
+    const std::size_t max_capacity_;
+    std::mutex mutex_;
+    std::vector<std::string> buffers_;  // 预留 max_buffers_ 个位置，归还时不分配内存
+};
+
+} // namespace network
@@ -0,0 +1,110 @@
+#include "host_resolver.hpp"
+#include "socket_address.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace network {
+
+HostResolver::HostResolver(const std::shared_ptr<ThreadConfigurator>& threads, std::size_t maxPending)
+    : state_(std::make_shared<State>()) {
+    state_->max_pending = std::max<std::size_t>(maxPending, 1);
+    thread_ = std::thread([state = state_]() { run(*state); });
+    if (threads) {
+        threads->apply(thread_, "resolver");
+    }
+}
+
+HostResolver::~HostResolver() {
+    bool busy = false;
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->stop = true;
+        state_->queue.clear();
+        state_->active_cancelled = true;
+        busy = state_->active != 0;
+        state_->wakeup.notify_one();
+    }
+
+    if (thread_.joinable()) {
+        // 查询DNS可能阻塞数秒，不等待；最后一个引用在回调中释放时也不能join自身
+        if (busy || thread_.get_id() == std::this_thread::get_id()) {
+            thread_.detach();
+        } else {
+            thread_.join();
+        }
+    }
+}
+
+HostResolver::RequestId HostResolver::resolve(const std::string& host, uint16_t port, ResolveCallback callback) {
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (!state_->stop && state_->queue.size() < state_->max_pending) {
+            RequestId id = state_->next_id++;
+            state_->queue.push_back(Request{id, host, port, std::move(callback)});
+            state_->wakeup.notify_one();
+            return id;
+        }
+    }
+
+    std::cerr << "地址解析失败: 排队的解析请求过多" << std::endl;
+    callback(false, sockaddr_storage{}, 0);
+    return 0;
+}
+
+void HostResolver::cancel(RequestId id) {
+    if (id == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->active == id) {
+        state_->active_cancelled = true;
+        return;
+    }
+    auto it = std::find_if(state_->queue.begin(), state_->queue.end(),
+                           [id](const Request& request) { return request.id == id; });
+    if (it != state_->queue.end()) {
+        state_->queue.erase(it);
+    }
+}
+
+void HostResolver::run(State& state) {
+    while (true) {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.wakeup.wait(lock, [&state]() { return state.stop || !state.queue.empty(); });
+            if (state.stop) {
+                return;
+            }
+            request = std::move(state.queue.front());
+            state.queue.pop_front();
+            state.active = request.id;
+            state.active_cancelled = false;
+        }
+
+        sockaddr_storage address{};
+        socklen_t length = 0;
+        bool resolved = resolveEndpoint(request.host, request.port, address, length);
+
+        bool cancelled = false;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            cancelled = state.active_cancelled;
+            state.active = 0;
+        }
+        if (cancelled) {
+            continue;
+        }
+
+        try {
+            request.callback(resolved, address, length);
+        } catch (const std::exception& e) {
+            std::cerr << "地址解析回调异常: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "地址解析回调发生未知异常" << std::endl;
+        }
+    }
+}
+
+} // namespace network
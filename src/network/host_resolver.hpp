@@ -0,0 +1,97 @@
+#pragma once
+
+#include "thread_settings.hpp"
+#include <sys/socket.h>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace network {
+
+/**
+ * @brief 地址解析结果回调
+ */
+using ResolveCallback = std::function<void(bool resolved, const sockaddr_storage& address, socklen_t length)>;
+
+/**
+ * @brief 主机名解析线程
+ *
+ * 由运行时持有，同一运行时的所有连接共享一个解析线程，请求按提交顺序依次查询DNS；
+ * 排队的请求数有上限，超过时直接以失败结束，不会为每次连接创建线程。
+ * 请求可以取消，回调由调用方保证只持有 weak_ptr，解析线程不延长连接对象的生命周期。
+ */
+class HostResolver {
+public:
+    using RequestId = uint64_t;
+
+    /// 默认最多排队的请求数
+    static constexpr std::size_t DEFAULT_MAX_PENDING = 64;
+
+    /**
+     * @brief 构造函数，立即启动解析线程
+     * @param threads 线程配置，为空时使用默认属性
+     * @param maxPending 最多排队的请求数
+     */
+    explicit HostResolver(const std::shared_ptr<ThreadConfigurator>& threads = nullptr,
+                          std::size_t maxPending = DEFAULT_MAX_PENDING);
+
+    /**
+     * @brief 析构函数，丢弃排队的请求并停止线程
+     *
+     * 正在查询DNS时不等待（getaddrinfo 无法中断），线程查询结束后丢弃结果并自行退出。
+     */
+    ~HostResolver();
+
+    HostResolver(const HostResolver&) = delete;
+    HostResolver& operator=(const HostResolver&) = delete;
+
+    /**
+     * @brief 提交解析请求（任意线程可调用）
+     * @param host 主机名
+     * @param port 端口号
+     * @param callback 解析完成后在解析线程中调用
+     * @return 请求编号；队列已满时为0，回调在调用线程中以失败调用
+     */
+    RequestId resolve(const std::string& host, uint16_t port, ResolveCallback callback);
+
+    /**
+     * @brief 取消请求（任意线程可调用）
+     * @param id 请求编号，已完成或为0时忽略
+     *
+     * 排队的请求直接移除；正在查询的请求在查询结束后丢弃结果。回调已开始执行时不等待它结束。
+     */
+    void cancel(RequestId id);
+
+private:
+    struct Request {
+        RequestId id = 0;
+        std::string host;
+        uint16_t port = 0;
+        ResolveCallback callback;
+    };
+
+    // 线程与本对象共享，本对象析构时线程分离后仍可安全访问
+    struct State {
+        std::mutex mutex;
+        std::condition_variable wakeup;
+        std::deque<Request> queue;
+        std::size_t max_pending = DEFAULT_MAX_PENDING;
+        RequestId next_id = 1;
+        RequestId active = 0;         // 正在查询的请求，0表示空闲
+        bool active_cancelled = false; // 正在查询的请求已被取消
+        bool stop = false;
+    };
+
+    static void run(State& state);
+
+    std::shared_ptr<State> state_;
+    std::thread thread_;
+};
+
+} // namespace network
@@ -0,0 +1,112 @@
+#include "io_context_pool.hpp"
+#include "spin_then_park.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+// 当前线程所属线程池的共享状态
+thread_local const void* current_pool = nullptr;
+}  // namespace
+
+namespace network {
+
+IoContextPool::IoContextPool(std::size_t thread_count, std::chrono::microseconds spin,
+                             const std::shared_ptr<ThreadConfigurator>& threads)
+    : state_(std::make_shared<State>(spin)) {
+    threads_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i) {
+        threads_.emplace_back([state = state_]() { run(*state); });
+        if (threads) {
+            threads->apply(threads_.back(), "io" + std::to_string(i));
+        }
+    }
+}
+
+IoContextPool::~IoContextPool() {
+    state_->work_guard.reset();
+    state_->io_context.stop();
+
+    for (auto& thread : threads_) {
+        if (!thread.joinable()) {
+            continue;
+        }
+        // 最后一个引用在线程池自己的线程中释放时不能join自身；
+        // 线程持有共享状态，当前处理函数返回后发现 io_context 已停止而退出
+        if (thread.get_id() == std::this_thread::get_id()) {
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+}
+
+bool IoContextPool::runningInThisThread() const {
+    return current_pool == state_.get();
+}
+
+std::size_t IoContextPool::poll(std::chrono::milliseconds timeout) {
+    // 处理函数中可能释放线程池的最后一个引用，执行期间持有共享状态
+    auto state = state_;
+
+    // 处理函数中判断是否在IO线程时视当前线程为IO线程，嵌套调用时恢复原值
+    const void* previous = current_pool;
+    current_pool = state.get();
+    auto& io_context = state->io_context;
+
+    std::size_t handlers = 0;
+    try {
+        if (io_context.stopped()) {
+            io_context.restart();
+        }
+        if (timeout.count() > 0) {
+            handlers += io_context.run_one_for(timeout);
+        }
+        handlers += io_context.poll();
+    } catch (const std::exception& e) {
+        std::cerr << "IO处理函数异常: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "IO处理函数未知异常" << std::endl;
+    }
+
+    current_pool = previous;
+    return handlers;
+}
+
+void IoContextPool::waitBriefly() {
+    if (callerDriven()) {
+        poll(std::chrono::milliseconds(1));
+    } else {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void IoContextPool::run(State& state) {
+    current_pool = &state;
+
+    auto& io_context = state.io_context;
+    SpinThenPark spin(state.spin);
+
+    // 单个处理函数抛出的异常不应终止整个线程池
+    while (!io_context.stopped()) {
+        try {
+            if (!spin.enabled()) {
+                io_context.run();
+                continue;
+            }
+            // 自旋时长内只执行就绪的处理函数（以零超时检查socket），之后阻塞到下一个处理函数
+            if (io_context.poll() > 0) {
+                spin.onActivity();
+            } else if (spin.spinning()) {
+                spin.relax();
+            } else if (io_context.run_one() > 0) {
+                spin.onActivity();
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "IO线程异常: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "IO线程未知异常" << std::endl;
+        }
+    }
+}
+
+} // namespace network
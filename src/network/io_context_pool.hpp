@@ -0,0 +1,135 @@
+#pragma once
+
+#include "thread_settings.hpp"
+#include <boost/asio.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace network {
+
+/**
+ * @brief io_context 线程池
+ *
+ * 一个 io_context 由固定数量的线程共同运行，多个连接共享这些线程，
+ * 每个连接通过自己的 strand 保证处理函数串行执行。
+ *
+ * 设置自旋时长时线程忙轮询（见 SpinThenPark），处理完事件后不立即在epoll中休眠。
+ *
+ * 线程数量为0时不创建线程，由调用方通过 poll() 驱动（调用方驱动模式）；
+ * SDK内部的同步等待（连接、断开、等待响应）在等待期间自行驱动 io_context。
+ */
+class IoContextPool {
+public:
+    /**
+     * @brief 构造函数，立即启动线程
+     * @param thread_count 线程数量，0表示调用方驱动
+     * @param spin 忙轮询的自旋时长，0表示不忙轮询
+     * @param threads 线程配置，为空时使用默认属性
+     */
+    explicit IoContextPool(std::size_t thread_count, std::chrono::microseconds spin = std::chrono::microseconds(0),
+                           const std::shared_ptr<ThreadConfigurator>& threads = nullptr);
+
+    /**
+     * @brief 析构函数，停止 io_context 并等待所有线程结束
+     */
+    ~IoContextPool();
+
+    IoContextPool(const IoContextPool&) = delete;
+    IoContextPool& operator=(const IoContextPool&) = delete;
+
+    /**
+     * @brief 获取共享的 io_context
+     * @return io_context 引用
+     */
+    boost::asio::io_context& context() { return state_->io_context; }
+
+    /**
+     * @brief 获取线程数量
+     * @return 线程数量
+     */
+    std::size_t threadCount() const { return threads_.size(); }
+
+    /**
+     * @brief 当前线程是否为本线程池的线程
+     * @return 是否在线程池线程中
+     *
+     * 在线程池线程中同步等待IO完成会导致死锁，调用方据此改为异步处理。
+     */
+    bool runningInThisThread() const;
+
+    /**
+     * @brief 是否为调用方驱动模式（没有后台线程）
+     */
+    bool callerDriven() const { return threads_.empty(); }
+
+    /**
+     * @brief 在当前线程中执行就绪的处理函数
+     * @param timeout 没有就绪的处理函数时最多等待的时间，0表示不等待
+     * @return 执行的处理函数数量
+     */
+    std::size_t poll(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief 等待future就绪，调用方驱动模式下等待期间执行就绪的处理函数
+     * @param future 等待的future
+     * @param deadline 截止时间
+     * @return future的状态
+     */
+    template <typename T>
+    std::future_status waitUntil(std::future<T>& future, std::chrono::steady_clock::time_point deadline) {
+        if (!callerDriven()) {
+            return future.wait_until(deadline);
+        }
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                return std::future_status::timeout;
+            }
+            auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - now);
+            poll(std::min(remaining, MAX_POLL_SLICE));
+        }
+        return std::future_status::ready;
+    }
+
+    /**
+     * @brief 等待future就绪，不限时间
+     */
+    template <typename T>
+    void wait(std::future<T>& future) {
+        waitUntil(future, std::chrono::steady_clock::time_point::max());
+    }
+
+    /**
+     * @brief 等待其他处理函数推进（如释放对象引用）：调用方驱动时执行就绪的处理函数，否则休眠1毫秒
+     */
+    void waitBriefly();
+
+private:
+    // 调用方驱动模式下同步等待时单次驱动的最长时间，之后重新检查等待条件
+    static constexpr std::chrono::milliseconds MAX_POLL_SLICE{10};
+
+    // 线程与本对象共享，本对象在线程池线程中析构时线程分离后仍可安全访问
+    struct State {
+        explicit State(std::chrono::microseconds spin_duration)
+            : work_guard(io_context.get_executor()), spin(spin_duration) {}
+
+        boost::asio::io_context io_context;
+        boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard;
+        std::chrono::microseconds spin;
+    };
+
+    /**
+     * @brief 线程函数
+     */
+    static void run(State& state);
+
+    std::shared_ptr<State> state_;
+    std::vector<std::thread> threads_;
+};
+
+} // namespace network
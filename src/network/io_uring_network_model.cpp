@@ -0,0 +1,480 @@
+#include "io_uring_network_model.hpp"
+#include "protocol/serializer.hpp"
+#include "safe_callback.hpp"
+#include "socket_address.hpp"
+#include "socket_options.hpp"
+#include <unistd.h>
+#include <algorithm>
+#include <climits>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <iostream>
+
+namespace {
+
+// 提交项的操作编号，完成时用于区分
+constexpr uint8_t OP_CONNECT = 1;
+constexpr uint8_t OP_CONNECT_TIMEOUT = 2;
+constexpr uint8_t OP_RECEIVE = 3;
+constexpr uint8_t OP_SEND = 4;
+constexpr uint8_t OP_CANCEL = 5;
+
+// 单个发送请求最多的缓冲区个数
+constexpr std::size_t MAX_IOV = IOV_MAX;
+
+// 距截止时间的剩余时长（向上取整到毫秒），已过截止时间时为0
+std::chrono::milliseconds remainingUntil(std::chrono::steady_clock::time_point deadline) {
+    auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+    return std::max(remaining, std::chrono::milliseconds(0));
+}
+
+}  // namespace
+
+namespace network {
+
+IoUringNetworkModel::IoUringNetworkModel(INetworkCallback& callback, std::shared_ptr<IoUringReactor> reactor,
+                                          std::shared_ptr<HostResolver> resolver)
+    : callback_(callback), reactor_(std::move(reactor)), resolver_(std::move(resolver)) {
+}
+
+IoUringNetworkModel::~IoUringNetworkModel() {
+    // 正常情况下描述符已在所有请求完成后关闭；事件循环停止时由这里关闭
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void IoUringNetworkModel::setConnectionTimeout(std::chrono::milliseconds timeout) {
+    connection_timeout_ = timeout;
+}
+
+void IoUringNetworkModel::setSocketOptions(const robotserver_sdk::SocketOptions& options) {
+    socket_options_ = options;
+}
+
+void IoUringNetworkModel::setSendQueueOptions(const robotserver_sdk::SendQueueOptions& options) {
+    outbound_queue_.setOptions(options);
+}
+
+bool IoUringNetworkModel::connect(const std::string& host, uint16_t port) {
+    // 如果已经连接，直接返回成功
+    if (connected_) {
+        return true;
+    }
+
+    // 在事件循环线程中同步等待连接完成会导致死锁
+    if (reactor_->runningInThisThread()) {
+        std::cerr << "连接失败: 不能在IO线程中同步连接" << std::endl;
+        return false;
+    }
+
+    auto result = std::make_shared<std::promise<bool>>();
+    std::future<bool> result_future = result->get_future();
+    connectAsync(host, port, [result](bool connected) {
+        result->set_value(connected);
+    });
+
+    return result_future.get();
+}
+
+void IoUringNetworkModel::connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) {
+    // 超时时间覆盖地址解析和连接两个阶段
+    auto deadline = std::chrono::steady_clock::now() + connection_timeout_;
+    auto resolve = std::make_shared<PendingResolve>();
+    resolve->callback = std::move(callback);
+
+    reactor_->post([this, self = shared_from_this(), host, port, deadline, resolve]() {
+        // 主机名在解析线程中查询DNS，超时先到时取消解析并以失败结束
+        resolve->timer = reactor_->runAfter(remainingUntil(deadline), [resolver = resolver_, resolve]() {
+            resolve->done = true;
+            resolver->cancel(resolve->request);
+            std::cerr << "连接失败: 地址解析超时" << std::endl;
+            if (resolve->callback) {
+                safeCallback(resolve->callback, "连接结果", false);
+            }
+        });
+
+        // 解析线程只持有弱引用：连接对象析构或超时后排队的结果被丢弃
+        auto callback = [weak = std::weak_ptr<IoUringNetworkModel>(self), pending = std::weak_ptr<PendingResolve>(resolve),
+                         deadline](bool resolved, const sockaddr_storage& address, socklen_t length) {
+            auto self = weak.lock();
+            auto resolve = pending.lock();
+            if (!self || !resolve) {
+                return;
+            }
+            self->reactor_->post([self, deadline, resolve, resolved, address, length]() {
+                if (resolve->done) {
+                    return;
+                }
+                resolve->done = true;
+                self->reactor_->cancelTimer(resolve->timer);
+
+                if (!resolved) {
+                    if (resolve->callback) {
+                        safeCallback(resolve->callback, "连接结果", false);
+                    }
+                    return;
+                }
+                self->startConnect(address, length, std::move(resolve->callback), deadline);
+            });
+        };
+        resolve->request = resolveEndpointAsync(*resolver_, host, port, std::move(callback));
+    });
+}
+
+void IoUringNetworkModel::startConnect(const sockaddr_storage& address, socklen_t length, ConnectCallback callback,
+                                       std::chrono::steady_clock::time_point deadline) {
+    // 如果已经连接，直接返回成功；同一连接同时只允许一个连接尝试
+    if (connected_ || connecting_ || pending_connect_) {
+        if (!connected_) {
+            std::cerr << "连接失败: 已有连接尝试正在进行" << std::endl;
+        }
+        if (callback) {
+            safeCallback(callback, "连接结果", static_cast<bool>(connected_));
+        }
+        return;
+    }
+
+    // 上一个socket的请求尚未全部完成，关闭完成后再发起连接
+    if (closing_) {
+        pending_connect_.reset(new PendingConnect{address, length, std::move(callback), deadline});
+        return;
+    }
+
+    decoder_.reset();
+
+    fd_ = ::socket(address.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) {
+        std::cerr << "连接失败: 创建socket失败: " << std::strerror(errno) << std::endl;
+        if (callback) {
+            safeCallback(callback, "连接结果", false);
+        }
+        return;
+    }
+
+    handler_id_ = reactor_->add(shared_from_this());
+    connecting_ = true;
+    connect_callback_ = std::move(callback);
+    connect_address_ = address;
+    auto timeout = remainingUntil(deadline);
+    connect_timeout_.tv_sec = timeout.count() / 1000;
+    connect_timeout_.tv_nsec = (timeout.count() % 1000) * 1000000;
+
+    // 连接请求和超时请求链接提交，先完成的一个取消另一个
+    io_uring_sqe* sqe = reactor_->prepare(handler_id_, OP_CONNECT);
+    sqe->opcode = IORING_OP_CONNECT;
+    sqe->fd = fd_;
+    sqe->addr = reinterpret_cast<uint64_t>(&connect_address_);
+    sqe->off = length;
+    sqe->flags = IOSQE_IO_LINK;
+
+    sqe = reactor_->prepare(handler_id_, OP_CONNECT_TIMEOUT);
+    sqe->opcode = IORING_OP_LINK_TIMEOUT;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<uint64_t>(&connect_timeout_);
+    sqe->len = 1;
+    inflight_ += 2;
+}
+
+void IoUringNetworkModel::finishConnect(int error) {
+    connecting_ = false;
+    ConnectCallback callback = std::move(connect_callback_);
+    connect_callback_ = nullptr;
+
+    if (error != 0) {
+        std::cerr << "连接失败: " << std::strerror(error) << std::endl;
+        closeSocket();
+    } else {
+        // 连接成功，设置socket选项后开始接收
+        applySocketOptions(fd_, socket_options_);
+        connected_ = true;
+        armReceive();
+    }
+
+    if (callback) {
+        safeCallback(callback, "连接结果", error == 0);
+    }
+}
+
+void IoUringNetworkModel::armReceive() {
+    io_uring_sqe* sqe = reactor_->prepare(handler_id_, OP_RECEIVE);
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd_;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = reactor_->bufferGroup();
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    ++inflight_;
+}
+
+void IoUringNetworkModel::disconnect() {
+    try {
+        // 已在事件循环线程中（如回调里），直接关闭
+        if (reactor_->runningInThisThread()) {
+            closeSocket();
+            return;
+        }
+
+        auto closed = std::make_shared<std::promise<void>>();
+        std::future<void> closed_future = closed->get_future();
+        reactor_->post([this, self = shared_from_this(), closed]() {
+            closeSocket();
+            closed->set_value();
+        });
+        closed_future.wait();
+    } catch (const std::exception& e) {
+        std::cerr << "断开连接异常: " << e.what() << std::endl;
+    }
+}
+
+void IoUringNetworkModel::closeSocket() {
+    connected_ = false;
+
+    if (fd_ >= 0 && !closing_) {
+        closing_ = true;
+        io_uring_sqe* sqe = reactor_->prepare(handler_id_, OP_CANCEL);
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = fd_;
+        sqe->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+        ++inflight_;
+    }
+
+    // 连接尝试进行中或等待中被断开，以失败结束
+    std::unique_ptr<PendingConnect> pending = std::move(pending_connect_);
+    if (pending && pending->callback) {
+        safeCallback(pending->callback, "连接结果", false);
+    }
+    if (connecting_) {
+        connecting_ = false;
+        ConnectCallback callback = std::move(connect_callback_);
+        connect_callback_ = nullptr;
+        if (callback) {
+            safeCallback(callback, "连接结果", false);
+        }
+    }
+}
+
+void IoUringNetworkModel::finalizeClose() {
+    closing_ = false;
+    ::close(fd_);
+    fd_ = -1;
+
+    // 发送请求已全部完成，可以释放发送缓冲区
+    outbound_queue_.clear();
+    batch_bytes_ = 0;
+    batch_written_ = 0;
+
+    // 事件循环在调用完成处理函数期间持有本对象的引用，注销是安全的
+    reactor_->remove(handler_id_);
+    handler_id_ = 0;
+
+    std::unique_ptr<PendingConnect> pending = std::move(pending_connect_);
+    if (pending) {
+        startConnect(pending->address, pending->length, std::move(pending->callback), pending->deadline);
+    }
+}
+
+void IoUringNetworkModel::connectionLost(const char* reason) {
+    // 已经关闭时不重复通知
+    if (!connected_) {
+        return;
+    }
+    std::cerr << reason << std::endl;
+    closeSocket();
+
+    safeCallback(
+        [this]() {
+            callback_.onConnectionStateChanged(robotserver_sdk::ConnectionState::DISCONNECTED);
+        },
+        "连接状态变化"
+    );
+}
+
+bool IoUringNetworkModel::isConnected() const {
+    return connected_;
+}
+
+bool IoUringNetworkModel::sendMessage(const protocol::IMessage& message) {
+    if (!isConnected()) {
+        return false;
+    }
+
+    try {
+        // 序列化消息，协议头和消息体分开存放，避免拼接拷贝；消息体复用已写出帧的缓冲区
+        protocol::Serializer serializer;
+        protocol::SerializedFrame frame;
+        frame.body = outbound_queue_.acquireBody();
+        serializer.serializeFrame(message, frame);
+
+        reactor_->post([this, self = shared_from_this(), frame = std::move(frame)]() mutable {
+            if (!isConnected()) {
+                return;
+            }
+
+            if (auto dropped = outbound_queue_.push(std::move(frame))) {
+                safeCallback(
+                    [this](uint16_t sequence) {
+                        callback_.onSendFailed(sequence);
+                    },
+                    "发送失败",
+                    *dropped
+                );
+            }
+
+            // 同一轮投递的帧在本轮结束时聚合为一个发送请求
+            if (!flush_scheduled_ && !outbound_queue_.writeInProgress()) {
+                flush_scheduled_ = true;
+                reactor_->defer([this, self = shared_from_this()]() {
+                    flush_scheduled_ = false;
+                    flush();
+                });
+            }
+        });
+
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "发送消息异常: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void IoUringNetworkModel::detachCallback() {
+    callback_.close();
+}
+
+robotserver_sdk::ConnectionStatistics IoUringNetworkModel::getStatistics() const {
+    robotserver_sdk::ConnectionStatistics stats;
+    outbound_queue_.fillStatistics(stats);
+    return stats;
+}
+
+void IoUringNetworkModel::onCompletion(uint8_t op, int32_t result, uint32_t flags, const char* data) {
+    // 多次触发的请求只有最后一个完成事件不带 F_MORE
+    if (!(flags & IORING_CQE_F_MORE)) {
+        --inflight_;
+    }
+
+    switch (op) {
+    case OP_CONNECT:
+        // 被链接的超时取消时结果为 -ECANCELED；被 closeSocket 取消时连接尝试已经结束
+        if (connecting_) {
+            finishConnect(result == -ECANCELED ? ETIMEDOUT : -result);
+        }
+        break;
+    case OP_RECEIVE:
+        handleReceive(result, flags, data);
+        break;
+    case OP_SEND:
+        handleSend(result);
+        break;
+    default:
+        break;
+    }
+
+    if (closing_ && inflight_ == 0) {
+        finalizeClose();
+    }
+}
+
+void IoUringNetworkModel::handleReceive(int32_t result, uint32_t flags, const char* data) {
+    if (!isConnected()) {
+        return;
+    }
+    if (result == 0) {
+        connectionLost("接收数据错误: 连接被对端关闭");
+        return;
+    }
+    if (result < 0 && result != -ENOBUFS) {
+        std::string reason = std::string("接收数据错误: ") + std::strerror(-result);
+        connectionLost(reason.c_str());
+        return;
+    }
+
+    if (result > 0 && data) {
+        // 共享缓冲区在处理函数返回后归还，拷入帧解码器后逐帧分发
+        protocol::Serializer serializer;
+        std::size_t remaining = static_cast<std::size_t>(result);
+        while (remaining > 0 && isConnected()) {
+            std::size_t writable = 0;
+            char* buffer = decoder_.prepare(writable);
+            std::size_t count = std::min(writable, remaining);
+            std::memcpy(buffer, data, count);
+            decoder_.commit(count);
+            data += count;
+            remaining -= count;
+
+            // 取出所有完整的帧，回调中可能断开连接
+            protocol::FrameView frame;
+            while (isConnected() && decoder_.nextFrame(frame)) {
+                auto message = serializer.deserializeFrame(frame.header, frame.body, frame.size);
+                if (!message) {
+                    continue;
+                }
+                safeCallback(
+                    [this](std::unique_ptr<protocol::IMessage>& msg) {
+                        callback_.onMessageReceived(std::move(msg));
+                    },
+                    "网络消息接收",
+                    message
+                );
+            }
+        }
+    }
+
+    // 缓冲区耗尽（-ENOBUFS）或内核结束了多次触发时重新挂起接收
+    if (!(flags & IORING_CQE_F_MORE) && isConnected()) {
+        armReceive();
+    }
+}
+
+void IoUringNetworkModel::handleSend(int32_t result) {
+    send_in_flight_ = false;
+    if (!isConnected()) {
+        return;
+    }
+    if (result < 0) {
+        std::string reason = std::string("发送数据错误: ") + std::strerror(-result);
+        connectionLost(reason.c_str());
+        return;
+    }
+
+    batch_written_ += static_cast<std::size_t>(result);
+    if (batch_written_ == batch_bytes_) {
+        outbound_queue_.completeBatch(batch_bytes_);
+    }
+    flush();
+}
+
+void IoUringNetworkModel::flush() {
+    if (!isConnected()) {
+        return;
+    }
+    if (!outbound_queue_.writeInProgress()) {
+        if (outbound_queue_.empty()) {
+            return;
+        }
+        // 排队帧（优先通道在前）聚合为一个发送请求
+        outbound_queue_.beginBatch();
+        batch_bytes_ = outbound_queue_.batchBytes();
+        batch_written_ = 0;
+    } else if (send_in_flight_) {
+        return;
+    }
+
+    // 跳过已写出的部分，构造剩余数据的缓冲区序列
+    outbound_queue_.gatherBatch(batch_written_, MAX_IOV, iov_);
+    send_msg_ = msghdr{};
+    send_msg_.msg_iov = iov_.data();
+    send_msg_.msg_iovlen = iov_.size();
+
+    io_uring_sqe* sqe = reactor_->prepare(handler_id_, OP_SEND);
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = fd_;
+    sqe->addr = reinterpret_cast<uint64_t>(&send_msg_);
+    sqe->len = 1;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    send_in_flight_ = true;
+    ++inflight_;
+}
+
+} // namespace network
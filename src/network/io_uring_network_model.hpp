@@ -0,0 +1,218 @@
+#pragma once
+
+#include "base_network_model.hpp"
+#include "callback_gate.hpp"
+#include "host_resolver.hpp"
+#include "io_uring_reactor.hpp"
+#include "outbound_queue.hpp"
+#include "protocol/frame_decoder.hpp"
+#include "types.h"
+#include <linux/time_types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace network {
+
+/**
+ * @brief 基于io_uring的网络模型实现
+ *
+ * 所有连接共享一个单线程的 IoUringReactor。连接建立后只挂起一个多次触发的接收请求，
+ * 数据由内核直接写入共享接收缓冲区环，不再需要每次就绪后调用 recv；
+ * 发送把排队帧聚合为一个 sendmsg 提交项，与其他连接的提交项在同一次 io_uring_enter 中提交。
+ * 连接超时使用链接的 LINK_TIMEOUT 提交项，不占用循环定时器。
+ *
+ * 关闭连接时先取消该socket上所有未完成的提交项，等全部完成事件到达后再关闭描述符并释放发送缓冲区，
+ * 因此内核不会访问已释放的内存。必须通过 std::make_shared 创建。
+ */
+class IoUringNetworkModel : public BaseNetworkModel,
+                            public IoUringReactor::Handler,
+                            public std::enable_shared_from_this<IoUringNetworkModel> {
+public:
+    /**
+     * @brief 构造函数
+     * @param callback 网络回调接口
+     * @param reactor 运行本连接的事件循环
+     * @param resolver 查询主机名的解析线程
+     */
+    IoUringNetworkModel(INetworkCallback& callback, std::shared_ptr<IoUringReactor> reactor,
+                        std::shared_ptr<HostResolver> resolver);
+
+    /**
+     * @brief 析构函数
+     */
+    ~IoUringNetworkModel() override;
+
+    /**
+     * @brief 连接到服务器
+     * @param host 主机地址
+     * @param port 端口号
+     * @return 是否连接成功
+     *
+     * 阻塞等待连接完成，不能在事件循环线程中调用。
+     */
+    bool connect(const std::string& host, uint16_t port) override;
+
+    /**
+     * @brief 异步连接到服务器
+     * @param host 主机地址
+     * @param port 端口号
+     * @param callback 连接完成后在事件循环线程中调用
+     *
+     * IP地址不涉及DNS查询，主机名在运行时共享的解析线程中查询DNS；连接超时覆盖解析和连接两个阶段，调用线程不会阻塞。
+     */
+    void connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) override;
+
+    /**
+     * @brief 断开连接
+     */
+    void disconnect() override;
+
+    /**
+     * @brief 检查是否已连接
+     * @return 是否已连接
+     */
+    bool isConnected() const override;
+
+    /**
+     * @brief 发送消息
+     * @param message 要发送的消息
+     * @return 是否发送成功
+     */
+    bool sendMessage(const protocol::IMessage& message) override;
+
+    /**
+     * @brief 获取连接统计信息
+     * @return 统计信息快照
+     */
+    robotserver_sdk::ConnectionStatistics getStatistics() const override;
+
+    /**
+     * @brief 断开与上层回调的联系，见 BaseNetworkModel::detachCallback()
+     */
+    void detachCallback() override;
+
+    /**
+     * @brief 设置连接超时时间
+     * @param timeout 超时时间（毫秒）
+     */
+    void setConnectionTimeout(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief 设置连接建立后应用的socket选项
+     * @param options socket选项
+     */
+    void setSocketOptions(const robotserver_sdk::SocketOptions& options);
+
+    /**
+     * @brief 设置发送队列的容量和排队策略
+     * @param options 发送队列配置
+     */
+    void setSendQueueOptions(const robotserver_sdk::SendQueueOptions& options);
+
+    /**
+     * @brief 提交项完成（在事件循环线程中调用）
+     */
+    void onCompletion(uint8_t op, int32_t result, uint32_t flags, const char* data) override;
+
+private:
+    /**
+     * @brief 等待发起的连接尝试（上一个socket尚未关闭完成时）
+     */
+    struct PendingConnect {
+        sockaddr_storage address;
+        socklen_t length;
+        ConnectCallback callback;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    /**
+     * @brief 一次地址解析的状态，由解析完成和超时两个任务共享（只在事件循环线程中访问）
+     */
+    struct PendingResolve {
+        ConnectCallback callback;
+        IoUringReactor::TimerId timer = 0;
+        HostResolver::RequestId request = 0; // 解析线程中的请求，超时时取消
+        bool done = false;
+    };
+
+    /**
+     * @brief 在事件循环中提交连接请求
+     * @param deadline 连接尝试的截止时间
+     */
+    void startConnect(const sockaddr_storage& address, socklen_t length, ConnectCallback callback,
+                      std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * @brief 结束一次连接尝试
+     * @param error 0表示成功，否则为errno
+     */
+    void finishConnect(int error);
+
+    /**
+     * @brief 提交多次触发的接收请求
+     */
+    void armReceive();
+
+    /**
+     * @brief 处理接收完成事件
+     */
+    void handleReceive(int32_t result, uint32_t flags, const char* data);
+
+    /**
+     * @brief 处理发送完成事件
+     */
+    void handleSend(int32_t result);
+
+    /**
+     * @brief 没有发送请求在进行时，把排队帧聚合为一个发送请求
+     */
+    void flush();
+
+    /**
+     * @brief 取消socket上的所有请求，结束进行中的连接尝试
+     */
+    void closeSocket();
+
+    /**
+     * @brief 所有请求都已完成后关闭描述符并释放收发状态
+     */
+    void finalizeClose();
+
+    /**
+     * @brief 收发出错导致连接丢失：关闭socket并通知回调
+     * @param reason 日志中的原因
+     */
+    void connectionLost(const char* reason);
+
+    GatedNetworkCallback callback_; // 经由闸门回调上层
+    std::shared_ptr<IoUringReactor> reactor_;
+    std::shared_ptr<HostResolver> resolver_;
+    std::chrono::milliseconds connection_timeout_{5000}; // 连接超时时间，默认5秒
+    robotserver_sdk::SocketOptions socket_options_; // 连接建立后应用的socket选项
+    std::atomic<bool> connected_{false};
+
+    // 以下成员只在事件循环线程中访问
+    int fd_ = -1;
+    uint32_t handler_id_ = 0;       // 在事件循环中的处理者编号，0表示未注册
+    unsigned inflight_ = 0;         // 尚未收到最后一个完成事件的提交项个数
+    bool closing_ = false;          // 正在等待提交项完成以关闭描述符
+    bool connecting_ = false;
+    ConnectCallback connect_callback_;
+    std::unique_ptr<PendingConnect> pending_connect_;
+    sockaddr_storage connect_address_{};  // 连接请求的目标地址，提交前保持有效
+    __kernel_timespec connect_timeout_{}; // 连接请求链接的超时
+    bool flush_scheduled_ = false;  // 本轮结束时是否已安排写出
+    bool send_in_flight_ = false;   // 是否有发送请求未完成
+    protocol::FrameDecoder decoder_;
+    OutboundQueue outbound_queue_;
+    std::size_t batch_bytes_ = 0;   // 批次总字节数
+    std::size_t batch_written_ = 0; // 批次已写出的字节数
+    std::vector<iovec> iov_;        // 发送请求的缓冲区序列，请求完成前保持不变
+    msghdr send_msg_{};             // 发送请求的消息头，请求完成前保持不变
+};
+
+} // namespace network
@@ -0,0 +1,392 @@
+#include "io_uring_reactor.hpp"
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <system_error>
+
+namespace {
+// 当前线程所属事件循环的共享状态
+thread_local const void* current_reactor = nullptr;
+
+// 提交队列和完成队列的大小，完成队列需容纳所有连接的多次触发接收
+constexpr unsigned SQ_ENTRIES = 256;
+constexpr unsigned CQ_ENTRIES = 4096;
+
+// 共享接收缓冲区池：缓冲区个数和每个缓冲区的大小
+constexpr unsigned BUFFER_COUNT = 256;
+constexpr std::size_t BUFFER_SIZE = 16 * 1024;
+constexpr uint16_t BUFFER_GROUP = 0;
+
+// 处理者编号为0的 user_data 保留给事件循环自己的提交项
+constexpr uint64_t WAKEUP_USER_DATA = 0;
+constexpr uint64_t PROVIDE_BUFFERS_USER_DATA = 1;
+
+int ioUringSetup(unsigned entries, io_uring_params* params) {
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int ioUringEnter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags, void* arg, std::size_t arg_size) {
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, arg_size));
+}
+
+template <typename T>
+T* ringField(void* ring, uint32_t offset) {
+    return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+}  // namespace
+
+namespace network {
+
+IoUringReactor::State::State(std::chrono::microseconds spin_duration) : spin_(spin_duration) {
+    wakeup_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeup_fd_ < 0) {
+        throw std::system_error(errno, std::generic_category(), "eventfd");
+    }
+}
+
+IoUringReactor::State::~State() {
+    teardown();
+    ::close(wakeup_fd_);
+}
+
+IoUringReactor::IoUringReactor(std::chrono::microseconds spin, const std::shared_ptr<ThreadConfigurator>& threads)
+    : state_(std::make_shared<State>(spin)) {
+    // SINGLE_ISSUER 要求创建环的线程就是提交线程，因此在循环线程中初始化并等待结果
+    std::promise<void> ready;
+    std::future<void> ready_future = ready.get_future();
+    thread_ = std::thread([state = state_, &ready]() { state->run(&ready); });
+    try {
+        ready_future.get();
+    } catch (...) {
+        thread_.join();
+        throw;
+    }
+    if (threads) {
+        threads->apply(thread_, "uring");
+    }
+}
+
+IoUringReactor::~IoUringReactor() {
+    state_->stopped_ = true;
+    uint64_t one = 1;
+    ssize_t ignored = ::write(state_->wakeup_fd_, &one, sizeof(one));
+    (void)ignored;
+
+    if (thread_.joinable()) {
+        // 最后一个引用在循环线程自己的任务中释放时不能join自身；
+        // 线程持有共享状态，本轮处理完后发现已停止而退出，环随共享状态一起释放
+        if (thread_.get_id() == std::this_thread::get_id()) {
+            thread_.detach();
+        } else {
+            thread_.join();
+        }
+    }
+}
+
+void IoUringReactor::post(Task task) {
+    // 队列中已有任务时循环线程必然会被唤醒，不重复写eventfd
+    if (state_->scheduler_.post(std::move(task))) {
+        uint64_t one = 1;
+        ssize_t ignored = ::write(state_->wakeup_fd_, &one, sizeof(one));
+        (void)ignored;
+    }
+}
+
+void IoUringReactor::defer(Task task) {
+    state_->scheduler_.defer(std::move(task));
+}
+
+bool IoUringReactor::runningInThisThread() const {
+    return current_reactor == state_.get();
+}
+
+uint32_t IoUringReactor::add(std::shared_ptr<Handler> handler) {
+    State& state = *state_;
+    uint32_t id = state.next_handler_id_++;
+    // 编号占 user_data 的高56位，0保留给唤醒请求
+    if (state.next_handler_id_ == 0) {
+        state.next_handler_id_ = 1;
+    }
+    state.handlers_[id] = std::move(handler);
+    return id;
+}
+
+void IoUringReactor::remove(uint32_t id) {
+    state_->handlers_.erase(id);
+}
+
+io_uring_sqe* IoUringReactor::prepare(uint32_t id, uint8_t op) {
+    return state_->prepare(id, op);
+}
+
+io_uring_sqe* IoUringReactor::State::prepare(uint32_t id, uint8_t op) {
+    // 提交队列已满时先把已准备的提交项交给内核
+    unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (sq_local_tail_ - head >= sq_entries_) {
+        __atomic_store_n(sq_tail_, sq_local_tail_, __ATOMIC_RELEASE);
+        if (ioUringEnter(ring_fd_, sq_local_tail_ - head, 0, 0, nullptr, 0) < 0) {
+            std::cerr << "io_uring提交失败: " << std::strerror(errno) << std::endl;
+        }
+    }
+
+    io_uring_sqe* sqe = &sqes_[sq_local_tail_ & sq_mask_];
+    ++sq_local_tail_;
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->user_data = (static_cast<uint64_t>(id) << 8) | op;
+    return sqe;
+}
+
+uint16_t IoUringReactor::bufferGroup() const {
+    return BUFFER_GROUP;
+}
+
+IoUringReactor::TimerId IoUringReactor::runAfter(std::chrono::milliseconds delay, Task task) {
+    return state_->scheduler_.runAfter(delay, std::move(task));
+}
+
+void IoUringReactor::cancelTimer(TimerId id) {
+    state_->scheduler_.cancelTimer(id);
+}
+
+void IoUringReactor::State::setupRing() {
+    io_uring_params params{};
+    params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_DEFER_TASKRUN;
+    params.cq_entries = CQ_ENTRIES;
+    ring_fd_ = ioUringSetup(SQ_ENTRIES, &params);
+    if (ring_fd_ < 0 && errno == EINVAL) {
+        // DEFER_TASKRUN 需要Linux 6.1，6.0上只使用 SINGLE_ISSUER
+        params = io_uring_params{};
+        params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SINGLE_ISSUER;
+        params.cq_entries = CQ_ENTRIES;
+        ring_fd_ = ioUringSetup(SQ_ENTRIES, &params);
+    }
+    if (ring_fd_ < 0) {
+        throw std::system_error(errno, std::generic_category(), "io_uring_setup");
+    }
+    if (!(params.features & IORING_FEAT_EXT_ARG) || !(params.features & IORING_FEAT_NODROP)) {
+        throw std::system_error(ENOTSUP, std::generic_category(), "io_uring features");
+    }
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                    ring_fd_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED) {
+        sq_ring_ = nullptr;
+        throw std::system_error(errno, std::generic_category(), "mmap sq ring");
+    }
+    if (single_mmap) {
+        cq_ring_ = sq_ring_;
+    } else {
+        cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring_fd_, IORING_OFF_CQ_RING);
+        if (cq_ring_ == MAP_FAILED) {
+            cq_ring_ = nullptr;
+            throw std::system_error(errno, std::generic_category(), "mmap cq ring");
+        }
+    }
+
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ring_fd_, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "mmap sqes");
+    }
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    sq_head_ = ringField<unsigned>(sq_ring_, params.sq_off.head);
+    sq_tail_ = ringField<unsigned>(sq_ring_, params.sq_off.tail);
+    sq_mask_ = *ringField<unsigned>(sq_ring_, params.sq_off.ring_mask);
+    sq_entries_ = params.sq_entries;
+    sq_local_tail_ = *sq_tail_;
+
+    // 提交项数组与提交队列一一对应，之后不再修改
+    unsigned* sq_array = ringField<unsigned>(sq_ring_, params.sq_off.array);
+    for (unsigned i = 0; i < sq_entries_; ++i) {
+        sq_array[i] = i;
+    }
+
+    cq_head_ = ringField<unsigned>(cq_ring_, params.cq_off.head);
+    cq_tail_ = ringField<unsigned>(cq_ring_, params.cq_off.tail);
+    cq_mask_ = *ringField<unsigned>(cq_ring_, params.cq_off.ring_mask);
+    cqes_ = ringField<io_uring_cqe>(cq_ring_, params.cq_off.cqes);
+}
+
+void IoUringReactor::State::setupBuffers() {
+    buffers_.resize(BUFFER_COUNT * BUFFER_SIZE);
+    recycled_.reserve(BUFFER_COUNT);
+    provideBuffers(0, BUFFER_COUNT);
+}
+
+void IoUringReactor::State::teardown() {
+    // 关闭环会取消所有未完成的提交项
+    if (ring_fd_ >= 0) {
+        ::close(ring_fd_);
+        ring_fd_ = -1;
+    }
+    if (sqes_) {
+        munmap(sqes_, sqes_size_);
+        sqes_ = nullptr;
+    }
+    if (cq_ring_ && cq_ring_ != sq_ring_) {
+        munmap(cq_ring_, cq_ring_size_);
+    }
+    cq_ring_ = nullptr;
+    if (sq_ring_) {
+        munmap(sq_ring_, sq_ring_size_);
+        sq_ring_ = nullptr;
+    }
+    handlers_.clear();
+}
+
+void IoUringReactor::State::armWakeup() {
+    io_uring_sqe* sqe = prepare(0, 0);
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = wakeup_fd_;
+    sqe->addr = reinterpret_cast<uint64_t>(&wakeup_value_);
+    sqe->len = sizeof(wakeup_value_);
+    sqe->user_data = WAKEUP_USER_DATA;
+}
+
+void IoUringReactor::State::provideBuffers(uint16_t first, uint16_t count) {
+    io_uring_sqe* sqe = prepare(0, 0);
+    sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+    sqe->fd = count;
+    sqe->addr = reinterpret_cast<uint64_t>(buffers_.data() + first * BUFFER_SIZE);
+    sqe->len = BUFFER_SIZE;
+    sqe->off = first;
+    sqe->buf_group = BUFFER_GROUP;
+    sqe->user_data = PROVIDE_BUFFERS_USER_DATA;
+}
+
+void IoUringReactor::State::recycleBuffers() {
+    if (recycled_.empty()) {
+        return;
+    }
+
+    // 多个连接交替使用缓冲区，排序后把编号连续的合并为一个提交项
+    std::sort(recycled_.begin(), recycled_.end());
+    std::size_t start = 0;
+    for (std::size_t i = 1; i <= recycled_.size(); ++i) {
+        if (i == recycled_.size() || recycled_[i] != recycled_[i - 1] + 1) {
+            provideBuffers(recycled_[start], static_cast<uint16_t>(i - start));
+            start = i;
+        }
+    }
+    recycled_.clear();
+}
+
+void IoUringReactor::State::submitAndWait(int timeout_ms) {
+    __atomic_store_n(sq_tail_, sq_local_tail_, __ATOMIC_RELEASE);
+    unsigned to_submit = sq_local_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+
+    __kernel_timespec timeout{};
+    io_uring_getevents_arg arg{};
+    if (timeout_ms >= 0) {
+        timeout.tv_sec = timeout_ms / 1000;
+        timeout.tv_nsec = static_cast<long long>(timeout_ms % 1000) * 1000000;
+        arg.ts = reinterpret_cast<uint64_t>(&timeout);
+    }
+
+    // 提交和等待完成事件合并为一次系统调用
+    int rc = ioUringEnter(ring_fd_, to_submit, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+    if (rc < 0 && errno != EINTR && errno != ETIME && errno != EBUSY) {
+        std::cerr << "io_uring_enter错误: " << std::strerror(errno) << std::endl;
+    }
+}
+
+unsigned IoUringReactor::State::processCompletions() {
+    unsigned head = *cq_head_;
+    unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+    unsigned completions = tail - head;
+
+    while (head != tail) {
+        const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        uint64_t user_data = cqe.user_data;
+        int32_t result = cqe.res;
+        uint32_t flags = cqe.flags;
+        // 先释放完成队列的槽位，处理函数中可能提交新的请求
+        __atomic_store_n(cq_head_, ++head, __ATOMIC_RELEASE);
+
+        if (user_data == WAKEUP_USER_DATA) {
+            if (!stopped_) {
+                armWakeup();
+            }
+            continue;
+        }
+        if (user_data == PROVIDE_BUFFERS_USER_DATA) {
+            if (result < 0) {
+                std::cerr << "io_uring归还接收缓冲区失败: " << std::strerror(-result) << std::endl;
+            }
+            continue;
+        }
+
+        const char* data = nullptr;
+        bool has_buffer = flags & IORING_CQE_F_BUFFER;
+        uint16_t buffer_id = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+        if (has_buffer) {
+            data = buffers_.data() + buffer_id * BUFFER_SIZE;
+        }
+
+        // 同一批完成事件中前面的处理可能已注销该处理者
+        auto it = handlers_.find(static_cast<uint32_t>(user_data >> 8));
+        if (it != handlers_.end()) {
+            std::shared_ptr<Handler> handler = it->second;
+
+            // 单个处理函数抛出的异常不应终止事件循环
+            try {
+                handler->onCompletion(static_cast<uint8_t>(user_data & 0xff), result, flags, data);
+            } catch (const std::exception& e) {
+                std::cerr << "io_uring完成事件处理异常: " << e.what() << std::endl;
+            } catch (...) {
+                std::cerr << "io_uring完成事件处理未知异常" << std::endl;
+            }
+        }
+
+        if (has_buffer) {
+            recycled_.push_back(buffer_id);
+        }
+    }
+
+    recycleBuffers();
+    return completions;
+}
+
+void IoUringReactor::State::run(std::promise<void>* ready) {
+    current_reactor = this;
+
+    try {
+        setupRing();
+        setupBuffers();
+        armWakeup();
+    } catch (...) {
+        teardown();
+        ready->set_exception(std::current_exception());
+        return;
+    }
+    ready->set_value();
+
+    while (!stopped_) {
+        // 忙轮询时以零超时进入内核，仍会执行延后的任务工作（DEFER_TASKRUN）并收割完成事件
+        int timeout = spin_.waitTimeout(scheduler_.runExpiredTimers());
+        submitAndWait(timeout);
+        if (processCompletions() > 0) {
+            spin_.onActivity();
+        } else if (timeout == 0) {
+            spin_.relax();
+        }
+        scheduler_.runTasks();
+    }
+}
+
+} // namespace network
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "loop_scheduler.hpp"
+#include "spin_then_park.hpp"
+#include "thread_settings.hpp"
+#include <linux/io_uring.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace network {
+
+/**
+ * @brief 基于io_uring的单线程事件循环
+ *
+ * 直接使用 io_uring_setup / io_uring_enter / io_uring_register 系统调用，不依赖liburing。
+ * 一轮循环中各连接准备的提交项（发送、重新挂起的接收等）在下一次 io_uring_enter 时一次性提交，
+ * 等待完成事件和提交共用同一次系统调用。
+ *
+ * 接收使用多次触发（multishot）recv 和交给内核的共享接收缓冲区池（provided buffers）：
+ * 每个连接只挂起一次接收请求，数据到达时内核从池中取出一块填充，
+ * 完成处理函数返回后缓冲区在本轮结束时归还（编号连续的缓冲区合并为一个提交项）。
+ *
+ * 环的创建、注册和所有提交都在循环线程中进行（IORING_SETUP_SINGLE_ISSUER），需要Linux 6.0及以上。
+ */
+class IoUringReactor {
+public:
+    using Task = LoopScheduler::Task;
+    using TimerId = LoopScheduler::TimerId;
+
+    /**
+     * @brief 完成事件处理接口
+     */
+    class Handler {
+    public:
+        virtual ~Handler() = default;
+
+        /**
+         * @brief 提交项完成（在循环线程中调用）
+         * @param op 提交时指定的操作编号
+         * @param result 完成结果（cqe->res），负数为 -errno
+         * @param flags 完成标志（cqe->flags）
+         * @param data 使用共享缓冲区接收时指向接收到的数据，否则为空；处理函数返回后失效
+         */
+        virtual void onCompletion(uint8_t op, int32_t result, uint32_t flags, const char* data) = 0;
+    };
+
+    /**
+     * @brief 构造函数，在循环线程中创建io_uring实例和共享接收缓冲区
+     * @param spin 忙轮询的自旋时长，0表示不忙轮询
+     * @param threads 线程配置，为空时使用默认属性
+     * @throws std::system_error 内核不支持io_uring或所需特性（由调用方回退到epoll）
+     */
+    explicit IoUringReactor(std::chrono::microseconds spin = std::chrono::microseconds(0),
+                            const std::shared_ptr<ThreadConfigurator>& threads = nullptr);
+
+    /**
+     * @brief 析构函数，停止并等待循环线程
+     */
+    ~IoUringReactor();
+
+    IoUringReactor(const IoUringReactor&) = delete;
+    IoUringReactor& operator=(const IoUringReactor&) = delete;
+
+    /**
+     * @brief 投递任务到循环线程执行（任意线程可调用）
+     */
+    void post(Task task);
+
+    /**
+     * @brief 延后到本轮完成事件和任务处理完之后执行（必须在循环线程中调用）
+     */
+    void defer(Task task);
+
+    /**
+     * @brief 当前线程是否为循环线程
+     */
+    bool runningInThisThread() const;
+
+    /**
+     * @brief 注册完成事件处理者（必须在循环线程中调用）
+     * @param handler 处理者，注册期间由事件循环持有
+     * @return 处理者编号，用于 prepare()
+     */
+    uint32_t add(std::shared_ptr<Handler> handler);
+
+    /**
+     * @brief 注销完成事件处理者（必须在循环线程中调用）
+     *
+     * 调用方需保证该处理者已没有未完成的提交项，否则之后到达的完成事件会被丢弃。
+     */
+    void remove(uint32_t id);
+
+    /**
+     * @brief 获取一个已清零的提交项（必须在循环线程中调用）
+     * @param id 处理者编号
+     * @param op 操作编号，完成时原样传回
+     * @return 提交项，在下一次提交前有效
+     */
+    io_uring_sqe* prepare(uint32_t id, uint8_t op);
+
+    /**
+     * @brief 共享接收缓冲区池的缓冲区组编号
+     */
+    uint16_t bufferGroup() const;
+
+    /**
+     * @brief 启动定时器（必须在循环线程中调用）
+     */
+    TimerId runAfter(std::chrono::milliseconds delay, Task task);
+
+    /**
+     * @brief 取消尚未到期的定时器（必须在循环线程中调用）
+     */
+    void cancelTimer(TimerId id);
+
+private:
+    // 循环线程与本对象共享，本对象在循环线程中析构时线程分离后仍可安全访问
+    struct State {
+        /**
+         * @brief 构造函数，创建用于跨线程唤醒的eventfd
+         * @throws std::system_error 创建eventfd失败
+         */
+        explicit State(std::chrono::microseconds spin_duration);
+
+        /**
+         * @brief 析构函数，释放io_uring实例、缓冲区和eventfd
+         */
+        ~State();
+
+        /**
+         * @brief 获取一个已清零的提交项，见 IoUringReactor::prepare
+         */
+        io_uring_sqe* prepare(uint32_t id, uint8_t op);
+
+        /**
+         * @brief 线程函数
+         * @param ready 初始化完成（或失败）后通知构造函数
+         */
+        void run(std::promise<void>* ready);
+
+        /**
+         * @brief 创建并映射io_uring实例
+         */
+        void setupRing();
+
+        /**
+         * @brief 分配共享接收缓冲区池并交给内核
+         */
+        void setupBuffers();
+
+        /**
+         * @brief 释放io_uring实例和缓冲区
+         */
+        void teardown();
+
+        /**
+         * @brief 挂起eventfd上的读请求，用于跨线程唤醒
+         */
+        void armWakeup();
+
+        /**
+         * @brief 提交所有已准备的提交项并等待至少一个完成事件
+         * @param timeout_ms 等待超时（毫秒），-1表示无限等待
+         */
+        void submitAndWait(int timeout_ms);
+
+        /**
+         * @brief 处理完成队列中的所有完成事件
+         * @return 处理的完成事件数
+         */
+        unsigned processCompletions();
+
+        /**
+         * @brief 把编号连续的一段缓冲区交给内核
+         */
+        void provideBuffers(uint16_t first, uint16_t count);
+
+        /**
+         * @brief 归还本轮完成事件用过的缓冲区
+         */
+        void recycleBuffers();
+
+        int ring_fd_ = -1;
+        int wakeup_fd_ = -1;
+        uint64_t wakeup_value_ = 0;     // eventfd读请求的接收缓冲区
+        std::atomic<bool> stopped_{false};
+
+        // 提交队列
+        void* sq_ring_ = nullptr;
+        std::size_t sq_ring_size_ = 0;
+        io_uring_sqe* sqes_ = nullptr;
+        std::size_t sqes_size_ = 0;
+        unsigned* sq_head_ = nullptr;
+        unsigned* sq_tail_ = nullptr;
+        unsigned sq_mask_ = 0;
+        unsigned sq_entries_ = 0;
+        unsigned sq_local_tail_ = 0;    // 已准备提交项的尾部，提交时发布给内核
+
+        // 完成队列
+        void* cq_ring_ = nullptr;
+        std::size_t cq_ring_size_ = 0;
+        io_uring_cqe* cqes_ = nullptr;
+        unsigned* cq_head_ = nullptr;
+        unsigned* cq_tail_ = nullptr;
+        unsigned cq_mask_ = 0;
+
+        // 共享接收缓冲区池
+        std::vector<char> buffers_;
+        std::vector<uint16_t> recycled_; // 本轮用过、待归还的缓冲区编号
+
+        LoopScheduler scheduler_;
+        SpinThenPark spin_; // 只在循环线程中访问
+        std::unordered_map<uint32_t, std::shared_ptr<Handler>> handlers_;
+        uint32_t next_handler_id_ = 1;
+    };
+
+    std::shared_ptr<State> state_;
+    std::thread thread_;
+};
+
+} // namespace network
@@ -0,0 +1,81 @@
+#include "loop_scheduler.hpp"
+#include <iostream>
+
+namespace network {
+
+bool LoopScheduler::post(Task task) {
+    std::lock_guard<std::mutex> lock(tasks_mutex_);
+    bool was_empty = tasks_.empty();
+    tasks_.push_back(std::move(task));
+    return was_empty;
+}
+
+void LoopScheduler::defer(Task task) {
+    deferred_.push_back(std::move(task));
+}
+
+void LoopScheduler::runTasks() {
+    {
+        std::lock_guard<std::mutex> lock(tasks_mutex_);
+        running_tasks_.swap(tasks_);
+    }
+    for (auto& task : running_tasks_) {
+        runGuarded(task, "任务");
+    }
+    running_tasks_.clear();
+
+    // 延后任务中可能再次延后，直到没有新任务为止
+    while (!deferred_.empty()) {
+        std::vector<Task> tasks;
+        tasks.swap(deferred_);
+        for (auto& task : tasks) {
+            runGuarded(task, "任务");
+        }
+    }
+}
+
+LoopScheduler::TimerId LoopScheduler::runAfter(std::chrono::milliseconds delay, Task task) {
+    TimerId id = next_timer_id_++;
+    auto it = timers_.emplace(Clock::now() + delay, std::make_pair(id, std::move(task)));
+    timer_index_[id] = it;
+    return id;
+}
+
+void LoopScheduler::cancelTimer(TimerId id) {
+    auto it = timer_index_.find(id);
+    if (it == timer_index_.end()) {
+        return;
+    }
+    timers_.erase(it->second);
+    timer_index_.erase(it);
+}
+
+int LoopScheduler::runExpiredTimers() {
+    auto now = Clock::now();
+    while (!timers_.empty() && timers_.begin()->first <= now) {
+        Task task = std::move(timers_.begin()->second.second);
+        timer_index_.erase(timers_.begin()->second.first);
+        timers_.erase(timers_.begin());
+        runGuarded(task, "定时器");
+    }
+
+    if (timers_.empty()) {
+        return -1;
+    }
+
+    // 向上取整，避免定时器未到期就醒来空转
+    auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(timers_.begin()->first - now);
+    return static_cast<int>(wait.count()) + 1;
+}
+
+void LoopScheduler::runGuarded(Task& task, const char* kind) {
+    try {
+        task();
+    } catch (const std::exception& e) {
+        std::cerr << "事件循环" << kind << "异常: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "事件循环" << kind << "未知异常" << std::endl;
+    }
+}
+
+} // namespace network
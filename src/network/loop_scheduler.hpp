@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace network {
+
+/**
+ * @brief 单线程事件循环的任务和定时器调度
+ *
+ * 供 EpollReactor / IoUringReactor 共用：其他线程投递的任务、本轮结束时执行的延后任务，
+ * 以及按到期时间排序的定时器。除 post() 外所有方法只能在循环线程中调用。
+ */
+class LoopScheduler {
+public:
+    using Task = std::function<void()>;
+    using TimerId = uint64_t;
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief 投递任务（任意线程可调用）
+     * @param task 任务
+     * @return 投递前队列是否为空，为空时调用方需要唤醒循环线程
+     */
+    bool post(Task task);
+
+    /**
+     * @brief 延后到本轮结束时执行
+     */
+    void defer(Task task);
+
+    /**
+     * @brief 执行投递的任务和延后的任务
+     */
+    void runTasks();
+
+    /**
+     * @brief 启动定时器
+     * @return 定时器编号
+     */
+    TimerId runAfter(std::chrono::milliseconds delay, Task task);
+
+    /**
+     * @brief 取消尚未到期的定时器
+     */
+    void cancelTimer(TimerId id);
+
+    /**
+     * @brief 执行到期的定时器
+     * @return 距下一个定时器的毫秒数（向上取整），没有定时器时为-1
+     */
+    int runExpiredTimers();
+
+private:
+    /**
+     * @brief 执行任务，单个任务抛出的异常不影响其他任务
+     */
+    static void runGuarded(Task& task, const char* kind);
+
+    std::mutex tasks_mutex_;
+    std::vector<Task> tasks_;         // 其他线程投递的任务
+    std::vector<Task> running_tasks_; // 正在执行的任务
+    std::vector<Task> deferred_;      // 本轮结束时执行的任务
+
+    std::multimap<Clock::time_point, std::pair<TimerId, Task>> timers_;
+    std::unordered_map<TimerId, decltype(timers_)::iterator> timer_index_;
+    TimerId next_timer_id_ = 1;
+};
+
+} // namespace network
@@ -0,0 +1,216 @@
+#include "outbound_queue.hpp"
+
+namespace {
+
+using robotserver_sdk::ActionCommand;
+using robotserver_sdk::SpeedCommand;
+
+// 单次写操作聚合的字节数上限（单个帧超过时单独写出），限制优先帧等待当前写操作完成的时间
+constexpr std::size_t MAX_BATCH_BYTES = 64 * 1024;
+
+// 安全相关命令：软急停和停止
+bool isSafetyCommand(const protocol::SerializedFrame& frame) {
+    return frame.type == protocol::MessageType::MOTION_CONTROL_REQ &&
+           (frame.command == static_cast<int>(ActionCommand::SOFT_EMERGENCY_STOP) ||
+            frame.command == static_cast<int>(ActionCommand::STOP));
+}
+
+bool isSpeedCommand(const protocol::SerializedFrame& frame) {
+    if (frame.type != protocol::MessageType::MOTION_CONTROL_REQ) {
+        return false;
+    }
+    switch (static_cast<SpeedCommand>(frame.command)) {
+    case SpeedCommand::FORWARD:
+    case SpeedCommand::BACKWARD:
+    case SpeedCommand::TURN_LEFT:
+    case SpeedCommand::TURN_RIGHT:
+    case SpeedCommand::TRANSVERSE_LEFT:
+    case SpeedCommand::TRANSVERSE_RIGHT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// 速度命令按运动方向归类：前进/后退、左转/右转、左移/右移各自只保留最新的一条
+int speedAxis(int command) {
+    switch (static_cast<SpeedCommand>(command)) {
+    case SpeedCommand::BACKWARD:
+        return static_cast<int>(SpeedCommand::FORWARD);
+    case SpeedCommand::TURN_RIGHT:
+        return static_cast<int>(SpeedCommand::TURN_LEFT);
+    case SpeedCommand::TRANSVERSE_RIGHT:
+        return static_cast<int>(SpeedCommand::TRANSVERSE_LEFT);
+    default:
+        return command;
+    }
+}
+
+// 两帧是否属于 LATEST_WINS 策略下的同一类
+bool sameKind(const protocol::SerializedFrame& a, const protocol::SerializedFrame& b) {
+    if (a.type != b.type) {
+        return false;
+    }
+    if (isSpeedCommand(a)) {
+        return isSpeedCommand(b) && speedAxis(a.command) == speedAxis(b.command);
+    }
+    return a.command == b.command;
+}
+
+}  // namespace
+
+namespace network {
+
+robotserver_sdk::SendQueuePolicy OutboundQueue::policyFor(const protocol::SerializedFrame& frame) const {
+    switch (frame.type) {
+    case protocol::MessageType::MOTION_CONTROL_REQ:
+        return isSpeedCommand(frame) ? options_.speedCommands : options_.motionCommands;
+    case protocol::MessageType::NAVIGATION_TASK_REQ:
+    case protocol::MessageType::CANCEL_TASK_REQ:
+        return options_.navigation;
+    case protocol::MessageType::GET_REAL_TIME_STATUS_REQ:
+    case protocol::MessageType::QUERY_STATUS_REQ:
+    case protocol::MessageType::RTK_FUSION_DATA_REQ:
+    case protocol::MessageType::RTK_RAW_DATA_REQ:
+        return options_.queries;
+    default:
+        return robotserver_sdk::SendQueuePolicy::ENQUEUE;
+    }
+}
+
+std::optional<uint16_t> OutboundQueue::push(protocol::SerializedFrame frame) {
+    // 安全相关命令从不丢弃，排在所有普通帧之前
+    if (options_.prioritizeSafetyCommands && isSafetyCommand(frame)) {
+        urgent_.push_back(std::move(frame));
+        updateDepth();
+        return std::nullopt;
+    }
+
+    robotserver_sdk::SendQueuePolicy policy = policyFor(frame);
+
+    // 替换尚未写出的同类旧帧，保持旧帧在队列中的位置
+    if (policy == robotserver_sdk::SendQueuePolicy::LATEST_WINS) {
+        for (auto& queued : queue_) {
+            if (sameKind(queued, frame)) {
+                uint16_t superseded = queued.header.sequenceNumber;
+                body_pool_.release(std::move(queued.body));
+                queued = std::move(frame);
+                frames_superseded_.fetch_add(1, std::memory_order_relaxed);
+                return superseded;
+            }
+        }
+    }
+
+    // 正在写出的批次也占用队列容量：链路阻塞时批次迟迟不能完成
+    std::size_t pending = urgent_.size() + queue_.size() + batch_.size();
+    bool full = options_.maxQueuedFrames != 0 && pending >= options_.maxQueuedFrames;
+    bool congested = policy == robotserver_sdk::SendQueuePolicy::FAIL_FAST &&
+                     pending >= options_.congestionThreshold;
+    if (full || congested) {
+        frames_dropped_.fetch_add(1, std::memory_order_relaxed);
+        body_pool_.release(std::move(frame.body));
+        return frame.header.sequenceNumber;
+    }
+
+    queue_.push_back(std::move(frame));
+    updateDepth();
+    return std::nullopt;
+}
+
+void OutboundQueue::updateDepth() {
+    uint64_t depth = urgent_.size() + queue_.size() + batch_.size();
+    queue_depth_.store(depth, std::memory_order_relaxed);
+    if (depth > max_queue_depth_.load(std::memory_order_relaxed)) {
+        max_queue_depth_.store(depth, std::memory_order_relaxed);
+    }
+}
+
+const std::vector<protocol::SerializedFrame>& OutboundQueue::beginBatch() {
+    std::size_t bytes = 0;
+    for (auto& frame : urgent_) {
+        bytes += protocol::PROTOCOL_HEADER_SIZE + frame.body.size();
+        batch_.push_back(std::move(frame));
+    }
+    urgent_.clear();
+
+    std::size_t taken = 0;
+    for (; taken < queue_.size(); ++taken) {
+        std::size_t size = protocol::PROTOCOL_HEADER_SIZE + queue_[taken].body.size();
+        if (!batch_.empty() && bytes + size > MAX_BATCH_BYTES) {
+            break;
+        }
+        bytes += size;
+        batch_.push_back(std::move(queue_[taken]));
+    }
+    // 移出的帧只剩空的消息体，删除时不释放内存；vector 保留容量
+    queue_.erase(queue_.begin(), queue_.begin() + taken);
+    return batch_;
+}
+
+std::size_t OutboundQueue::batchBytes() const {
+    std::size_t bytes = 0;
+    for (const auto& frame : batch_) {
+        bytes += protocol::PROTOCOL_HEADER_SIZE + frame.body.size();
+    }
+    return bytes;
+}
+
+void OutboundQueue::gatherBatch(std::size_t offset, std::size_t max_buffers, std::vector<iovec>& iov) const {
+    iov.clear();
+    for (const auto& frame : batch_) {
+        // 协议头和消息体作为独立缓冲区，跳过已写出的部分
+        const char* parts[2] = {reinterpret_cast<const char*>(&frame.header), frame.body.data()};
+        std::size_t sizes[2] = {protocol::PROTOCOL_HEADER_SIZE, frame.body.size()};
+        for (int i = 0; i < 2; ++i) {
+            if (iov.size() >= max_buffers) {
+                return;
+            }
+            if (offset >= sizes[i]) {
+                offset -= sizes[i];
+                continue;
+            }
+            iov.push_back(iovec{const_cast<char*>(parts[i]) + offset, sizes[i] - offset});
+            offset = 0;
+        }
+    }
+}
+
+void OutboundQueue::completeBatch(std::size_t bytes_written) {
+    uint64_t frames = batch_.size();
+    recycle(batch_);
+    updateDepth();
+
+    frames_sent_.fetch_add(frames, std::memory_order_relaxed);
+    write_operations_.fetch_add(1, std::memory_order_relaxed);
+    bytes_sent_.fetch_add(bytes_written, std::memory_order_relaxed);
+    if (frames > max_frames_per_write_.load(std::memory_order_relaxed)) {
+        max_frames_per_write_.store(frames, std::memory_order_relaxed);
+    }
+}
+
+void OutboundQueue::clear() {
+    recycle(urgent_);
+    recycle(queue_);
+    recycle(batch_);
+    queue_depth_.store(0, std::memory_order_relaxed);
+}
+
+void OutboundQueue::recycle(std::vector<protocol::SerializedFrame>& frames) {
+    for (auto& frame : frames) {
+        body_pool_.release(std::move(frame.body));
+    }
+    frames.clear();
+}
+
+void OutboundQueue::fillStatistics(robotserver_sdk::ConnectionStatistics& stats) const {
+    stats.framesSent = frames_sent_.load(std::memory_order_relaxed);
+    stats.writeOperations = write_operations_.load(std::memory_order_relaxed);
+    stats.bytesSent = bytes_sent_.load(std::memory_order_relaxed);
+    stats.maxFramesPerWrite = max_frames_per_write_.load(std::memory_order_relaxed);
+    stats.queueDepth = queue_depth_.load(std::memory_order_relaxed);
+    stats.maxQueueDepth = max_queue_depth_.load(std::memory_order_relaxed);
+    stats.framesDropped = frames_dropped_.load(std::memory_order_relaxed);
+    stats.framesSuperseded = frames_superseded_.load(std::memory_order_relaxed);
+}
+
+} // namespace network
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "frame_buffer_pool.hpp"
+#include "protocol/serializer.hpp"
+#include "types.h"
+#include <sys/uio.h>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace network {
+
+/**
+ * @brief 每连接的发送队列
+ *
+ * 保证同一时刻只有一个写操作在进行：写操作完成前新到的帧在队列中等待，
+ * 完成后把排队帧聚合成一次写操作（writev）。
+ * 等待写出的帧数受 SendQueueOptions 限制，按消息类型选择排队策略：
+ * 被丢弃或被取代的帧由 push() 返回其序列号，调用方据此通知上层请求失败。
+ * 软急停和停止命令进入优先通道，下一次写操作总是先写出优先通道中的帧；
+ * 单次写操作的字节数有上限，因此优先帧最多等待一个写操作完成。
+ * 写出、丢弃或被取代的帧的消息体归还到缓冲区池，发送线程通过 acquireBody() 取出复用，
+ * 各通道使用保留容量的 vector，稳定运行时入队和写出不分配内存。
+ * 队列本身不加锁，必须在连接的串行执行上下文（strand / 事件循环线程）中访问；
+ * acquireBody() 和统计计数可在任意线程调用。
+ */
+class OutboundQueue {
+public:
+    /**
+     * @brief 设置队列容量和排队策略
+     * @param options 发送队列配置
+     */
+    void setOptions(const robotserver_sdk::SendQueueOptions& options) { options_ = options; }
+
+    /**
+     * @brief 取出一个复用的消息体缓冲区，用于序列化待发送的帧，可在任意线程调用
+     * @return 空缓冲区，容量来自之前写出的帧
+     */
+    std::string acquireBody() { return body_pool_.acquire(); }
+
+    /**
+     * @brief 帧入队
+     * @param frame 待发送的帧
+     * @return 被丢弃（新帧）或被取代（旧帧）的帧的序列号，没有帧被丢弃时为空
+     */
+    std::optional<uint16_t> push(protocol::SerializedFrame frame);
+
+    /**
+     * @brief 是否有等待发送的帧（不含正在写出的批次）
+     */
+    bool empty() const { return queue_.empty() && urgent_.empty(); }
+
+    /**
+     * @brief 是否有正在写出的批次
+     */
+    bool writeInProgress() const { return !batch_.empty(); }
+
+    /**
+     * @brief 将排队帧移入写出批次：先取优先通道的全部帧，再按顺序取普通帧直到批次字节数上限
+     * @return 写出批次，在 completeBatch() 之前保持不变（帧地址稳定）
+     */
+    const std::vector<protocol::SerializedFrame>& beginBatch();
+
+    /**
+     * @brief 写出批次的总字节数（协议头+消息体）
+     */
+    std::size_t batchBytes() const;
+
+    /**
+     * @brief 构造写出批次中尚未写出部分的缓冲区序列，用于 writev / sendmsg
+     * @param offset 批次中已写出的字节数
+     * @param max_buffers 最多的缓冲区个数（IOV_MAX）
+     * @param iov 输出参数，缓冲区序列（先清空）
+     */
+    void gatherBatch(std::size_t offset, std::size_t max_buffers, std::vector<iovec>& iov) const;
+
+    /**
+     * @brief 写出批次完成，释放批次并记录统计
+     * @param bytes_written 本次写出的字节数
+     */
+    void completeBatch(std::size_t bytes_written);
+
+    /**
+     * @brief 丢弃所有排队和正在写出的帧（断开连接时使用）
+     */
+    void clear();
+
+    /**
+     * @brief 将发送统计填入连接统计信息
+     * @param stats 输出参数
+     */
+    void fillStatistics(robotserver_sdk::ConnectionStatistics& stats) const;
+
+private:
+    /**
+     * @brief 按消息类型选择排队策略
+     */
+    robotserver_sdk::SendQueuePolicy policyFor(const protocol::SerializedFrame& frame) const;
+
+    /**
+     * @brief 更新队列深度统计
+     */
+    void updateDepth();
+
+    /**
+     * @brief 清空一组帧，消息体归还到缓冲区池
+     */
+    void recycle(std::vector<protocol::SerializedFrame>& frames);
+
+    robotserver_sdk::SendQueueOptions options_;
+    FrameBufferPool body_pool_;
+    std::vector<protocol::SerializedFrame> urgent_;  // 优先通道：等待发送的安全相关命令
+    std::vector<protocol::SerializedFrame> queue_;   // 普通通道：等待发送的帧
+    std::vector<protocol::SerializedFrame> batch_;   // 正在写出的批次
+
+    std::atomic<uint64_t> frames_sent_{0};
+    std::atomic<uint64_t> write_operations_{0};
+    std::atomic<uint64_t> bytes_sent_{0};
+    std::atomic<uint64_t> max_frames_per_write_{0};
+    std::atomic<uint64_t> queue_depth_{0};
+    std::atomic<uint64_t> max_queue_depth_{0};
+    std::atomic<uint64_t> frames_dropped_{0};
+    std::atomic<uint64_t> frames_superseded_{0};
+};
+
+} // namespace network
@@ -0,0 +1,292 @@
+#include "reconnecting_network_model.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace network {
+
+using robotserver_sdk::ConnectionState;
+
+ReconnectingNetworkModel::ReconnectingNetworkModel(INetworkCallback& callback,
+                                                   std::shared_ptr<IoContextPool> pool,
+                                                   const robotserver_sdk::ReconnectOptions& options)
+    : callback_(callback),
+      pool_(std::move(pool)),
+      options_(options),
+      timer_(pool_->context()),
+      random_(std::random_device{}()) {
+}
+
+ReconnectingNetworkModel::~ReconnectingNetworkModel() {
+    // 关闭传输层的回调闸门，等待其他线程中正在回调本对象的处理函数结束
+    if (transport_) {
+        transport_->detachCallback();
+    }
+}
+
+void ReconnectingNetworkModel::setTransport(std::shared_ptr<BaseNetworkModel> transport) {
+    transport_ = std::move(transport);
+}
+
+bool ReconnectingNetworkModel::beginConnect(const std::string& host, uint16_t port) {
+    bool already_connected = transport_->isConnected();
+    ConnectionState new_state = already_connected ? ConnectionState::CONNECTED : ConnectionState::CONNECTING;
+    bool changed = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // 用户重新发起连接，取消正在等待的自动重连
+        ++generation_;
+        timer_.cancel();
+        attempt_ = 0;
+        host_ = host;
+        port_ = port;
+        changed = state_ != new_state;
+        state_ = new_state;
+    }
+    if (changed) {
+        notifyState(new_state);
+    }
+    return !already_connected;
+}
+
+bool ReconnectingNetworkModel::finishConnect(uint64_t generation, bool connected) {
+    ConnectionState new_state = connected ? ConnectionState::CONNECTED : ConnectionState::DISCONNECTED;
+    bool lost = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // 连接期间用户又发起了新的连接或断开，以新的操作为准
+        if (generation != generation_) {
+            return connected;
+        }
+        // 连接成功后、状态更新前连接已经丢失：状态仍为 CONNECTING 时传输层报告的丢失被忽略，这里补上
+        if (connected && !transport_->isConnected()) {
+            lost = true;
+            new_state = ConnectionState::DISCONNECTED;
+            if (options_.enabled) {
+                new_state = ConnectionState::RECONNECTING;
+                attempt_ = 0;
+                scheduleReconnectLocked();
+            }
+        }
+        if (state_ == new_state) {
+            return !lost && connected;
+        }
+        state_ = new_state;
+    }
+    if (lost) {
+        std::cerr << "连接丢失" << (options_.enabled ? "，开始自动重连" : "") << std::endl;
+    }
+    notifyState(new_state);
+    return !lost && connected;
+}
+
+bool ReconnectingNetworkModel::connect(const std::string& host, uint16_t port) {
+    if (!beginConnect(host, port)) {
+        return true;
+    }
+
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        generation = generation_;
+    }
+
+    return finishConnect(generation, transport_->connect(host, port));
+}
+
+void ReconnectingNetworkModel::connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) {
+    if (!beginConnect(host, port)) {
+        if (callback) {
+            callback(true);
+        }
+        return;
+    }
+
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        generation = generation_;
+    }
+
+    auto self = shared_from_this();
+    transport_->connectAsync(host, port, [this, self, generation, callback = std::move(callback)](bool connected) {
+        connected = finishConnect(generation, connected);
+        if (callback) {
+            // 上层析构后不再回调
+            callback_.run([&]() { callback(connected); });
+        }
+    });
+}
+
+void ReconnectingNetworkModel::disconnect() {
+    bool changed = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++generation_;
+        timer_.cancel();
+        attempt_ = 0;
+        changed = state_ != ConnectionState::DISCONNECTED;
+        state_ = ConnectionState::DISCONNECTED;
+    }
+
+    transport_->disconnect();
+
+    if (changed) {
+        notifyState(ConnectionState::DISCONNECTED);
+    }
+}
+
+bool ReconnectingNetworkModel::isConnected() const {
+    return transport_->isConnected();
+}
+
+bool ReconnectingNetworkModel::sendMessage(const protocol::IMessage& message) {
+    return transport_->sendMessage(message);
+}
+
+void ReconnectingNetworkModel::detachCallback() {
+    callback_.close();
+}
+
+robotserver_sdk::ConnectionStatistics ReconnectingNetworkModel::getStatistics() const {
+    robotserver_sdk::ConnectionStatistics stats = transport_->getStatistics();
+    stats.reconnectCount = reconnect_count_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+int ReconnectingNetworkModel::nativeHandle() const {
+    return transport_->nativeHandle();
+}
+
+ConnectionState ReconnectingNetworkModel::state() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return state_;
+}
+
+void ReconnectingNetworkModel::onMessageReceived(std::unique_ptr<protocol::IMessage> message) {
+    // 回调期间保持本对象存活，析构已开始时丢弃
+    auto self = weak_from_this().lock();
+    if (!self) {
+        return;
+    }
+    callback_.onMessageReceived(std::move(message));
+}
+
+void ReconnectingNetworkModel::onSendFailed(uint16_t sequenceNumber) {
+    auto self = weak_from_this().lock();
+    if (!self) {
+        return;
+    }
+    callback_.onSendFailed(sequenceNumber);
+}
+
+void ReconnectingNetworkModel::onConnectionStateChanged(ConnectionState state) {
+    // 传输层只报告连接丢失
+    if (state != ConnectionState::DISCONNECTED) {
+        return;
+    }
+    auto self = weak_from_this().lock();
+    if (!self) {
+        return;
+    }
+
+    ConnectionState new_state = ConnectionState::DISCONNECTED;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // 主动断开或已在处理时忽略
+        if (state_ != ConnectionState::CONNECTED) {
+            return;
+        }
+
+        if (options_.enabled) {
+            new_state = ConnectionState::RECONNECTING;
+            attempt_ = 0;
+            scheduleReconnectLocked();
+        }
+        state_ = new_state;
+    }
+
+    std::cerr << "连接丢失" << (options_.enabled ? "，开始自动重连" : "") << std::endl;
+    notifyState(new_state);
+}
+
+void ReconnectingNetworkModel::scheduleReconnectLocked() {
+    uint64_t generation = generation_;
+    timer_.expires_after(backoffDelayLocked(attempt_));
+    timer_.async_wait([this, self = shared_from_this(), generation](const boost::system::error_code& ec) {
+        if (!ec) {
+            attemptReconnect(generation);
+        }
+    });
+}
+
+void ReconnectingNetworkModel::attemptReconnect(uint64_t generation) {
+    std::string host;
+    uint16_t port = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (generation != generation_ || state_ != ConnectionState::RECONNECTING) {
+            return;
+        }
+        ++attempt_;
+        host = host_;
+        port = port_;
+    }
+
+    transport_->connectAsync(host, port, [this, self = shared_from_this(), generation](bool connected) {
+        onReconnectResult(generation, connected);
+    });
+}
+
+void ReconnectingNetworkModel::onReconnectResult(uint64_t generation, bool connected) {
+    ConnectionState new_state;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (generation != generation_ || state_ != ConnectionState::RECONNECTING) {
+            return;
+        }
+
+        // 重连成功后随即丢失的连接按失败处理，丢失通知在 RECONNECTING 状态下被忽略
+        if (connected && transport_->isConnected()) {
+            new_state = ConnectionState::CONNECTED;
+            attempt_ = 0;
+            reconnect_count_.fetch_add(1, std::memory_order_relaxed);
+        } else if (options_.maxAttempts > 0 && attempt_ >= options_.maxAttempts) {
+            std::cerr << "自动重连失败: 已达到最大重连次数 " << options_.maxAttempts << std::endl;
+            new_state = ConnectionState::DISCONNECTED;
+        } else {
+            // 继续退避重连，状态不变
+            scheduleReconnectLocked();
+            return;
+        }
+        state_ = new_state;
+    }
+    notifyState(new_state);
+}
+
+std::chrono::milliseconds ReconnectingNetworkModel::backoffDelayLocked(int attempt) {
+    double delay = static_cast<double>(options_.initialDelay.count()) *
+                   std::pow(std::max(options_.backoffMultiplier, 1.0), attempt);
+    delay = std::min(delay, static_cast<double>(options_.maxDelay.count()));
+
+    // 随机浮动，避免大量连接在同一时刻重连
+    double jitter = std::clamp(options_.jitter, 0.0, 1.0);
+    if (jitter > 0.0) {
+        std::uniform_real_distribution<double> distribution(1.0 - jitter, 1.0 + jitter);
+        delay *= distribution(random_);
+    }
+
+    return std::chrono::milliseconds(static_cast<int64_t>(std::max(delay, 0.0)));
+}
+
+void ReconnectingNetworkModel::notifyState(ConnectionState state) {
+    try {
+        callback_.onConnectionStateChanged(state);
+    } catch (const std::exception& e) {
+        std::cerr << "连接状态回调异常: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "连接状态回调发生未知异常" << std::endl;
+    }
+}
+
+} // namespace network
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "base_network_model.hpp"
+#include "callback_gate.hpp"
+#include "io_context_pool.hpp"
+#include "types.h"
+#include <boost/asio.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+
+namespace network {
+
+/**
+ * @brief 自动重连装饰器
+ *
+ * 包装任意传输层实现，维护连接状态机并在连接丢失后按指数退避自动重连：
+ *
+ *   DISCONNECTED --connect--> CONNECTING --成功--> CONNECTED
+ *   CONNECTED --连接丢失--> RECONNECTING --成功--> CONNECTED
+ *   RECONNECTING --超过最大次数 / disconnect--> DISCONNECTED
+ *
+ * 所有状态变化都通过 INetworkCallback::onConnectionStateChanged 通知上层。
+ * 重连定时器运行在共享的IO线程池上，不额外创建线程。
+ * 异步处理函数持有 shared_from_this()，因此必须通过 std::make_shared 创建，
+ * 并在构造后调用 setTransport() 设置被包装的传输层。
+ */
+class ReconnectingNetworkModel : public BaseNetworkModel,
+                                 public INetworkCallback,
+                                 public std::enable_shared_from_this<ReconnectingNetworkModel> {
+public:
+    /**
+     * @brief 构造函数
+     * @param callback 上层回调接口
+     * @param pool 运行重连定时器的IO线程池
+     * @param options 自动重连配置
+     */
+    ReconnectingNetworkModel(INetworkCallback& callback,
+                             std::shared_ptr<IoContextPool> pool,
+                             const robotserver_sdk::ReconnectOptions& options);
+
+    /**
+     * @brief 析构函数，等待传输层的异步处理函数全部结束
+     */
+    ~ReconnectingNetworkModel() override;
+
+    /**
+     * @brief 设置被包装的传输层，其回调接口必须为本对象
+     * @param transport 传输层实现
+     */
+    void setTransport(std::shared_ptr<BaseNetworkModel> transport);
+
+    bool connect(const std::string& host, uint16_t port) override;
+    void connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) override;
+
+    /**
+     * @brief 断开连接，同时取消正在进行的自动重连
+     */
+    void disconnect() override;
+
+    bool isConnected() const override;
+    bool sendMessage(const protocol::IMessage& message) override;
+    robotserver_sdk::ConnectionStatistics getStatistics() const override;
+    void detachCallback() override;
+    int nativeHandle() const override;
+
+    /**
+     * @brief 获取当前连接状态
+     * @return 连接状态
+     */
+    robotserver_sdk::ConnectionState state() const;
+
+    // INetworkCallback，由传输层调用
+    void onMessageReceived(std::unique_ptr<protocol::IMessage> message) override;
+    void onConnectionStateChanged(robotserver_sdk::ConnectionState state) override;
+    void onSendFailed(uint16_t sequenceNumber) override;
+
+private:
+    /**
+     * @brief 开始一次用户发起的连接（连接前调用）
+     * @return 是否需要真正发起连接（已连接时为false）
+     */
+    bool beginConnect(const std::string& host, uint16_t port);
+
+    /**
+     * @brief 结束一次用户发起的连接
+     * @param generation 发起连接时的代数
+     * @param connected 是否连接成功
+     * @return 连接结果；连接成功但随即丢失时为 false
+     */
+    bool finishConnect(uint64_t generation, bool connected);
+
+    /**
+     * @brief 安排下一次重连（必须持有 mutex_）
+     */
+    void scheduleReconnectLocked();
+
+    /**
+     * @brief 定时器到期，发起一次重连
+     * @param generation 安排重连时的代数，用户操作后过期的定时器直接忽略
+     */
+    void attemptReconnect(uint64_t generation);
+
+    /**
+     * @brief 重连结果处理
+     * @param generation 发起重连时的代数
+     * @param connected 是否重连成功
+     */
+    void onReconnectResult(uint64_t generation, bool connected);
+
+    /**
+     * @brief 计算第 attempt 次重连前的等待时间（必须持有 mutex_）
+     */
+    std::chrono::milliseconds backoffDelayLocked(int attempt);
+
+    /**
+     * @brief 通知上层状态变化（不能持有 mutex_）
+     */
+    void notifyState(robotserver_sdk::ConnectionState state);
+
+    GatedNetworkCallback callback_; // 经由闸门回调上层
+    std::shared_ptr<IoContextPool> pool_;
+    robotserver_sdk::ReconnectOptions options_;
+    std::shared_ptr<BaseNetworkModel> transport_;
+
+    mutable std::mutex mutex_; // 保护以下成员
+    robotserver_sdk::ConnectionState state_ = robotserver_sdk::ConnectionState::DISCONNECTED;
+    std::string host_;
+    uint16_t port_ = 0;
+    int attempt_ = 0;          // 本轮连续重连失败次数
+    uint64_t generation_ = 0;  // 每次用户发起连接或断开时递增，使进行中的重连失效
+    boost::asio::steady_timer timer_;
+    std::mt19937 random_;
+
+    std::atomic<uint64_t> reconnect_count_{0};
+};
+
+} // namespace network
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace network {
+
+/**
+ * @brief 安全回调包装函数，用于捕获和处理回调函数中可能抛出的异常
+ * @tparam Callback 回调函数类型
+ * @tparam Args 回调函数参数类型
+ * @param callback 回调函数
+ * @param callbackType 回调函数类型描述，用于日志记录
+ * @param args 回调函数参数
+ */
+template<typename Callback, typename... Args>
+void safeCallback(const Callback& callback, const std::string& callbackType, Args&&... args) {
+    try {
+        callback(std::forward<Args>(args)...);
+    } catch (const std::exception& e) {
+        auto now = std::chrono::system_clock::now();
+        auto time_t_now = std::chrono::system_clock::to_time_t(now);
+        std::stringstream ss;
+        ss << std::put_time(std::localtime(&time_t_now), "%Y-%m-%d %H:%M:%S");
+
+        std::cerr << "[" << ss.str() << "] " << callbackType << " 回调函数异常: " << e.what() << std::endl;
+    } catch (...) {
+        auto now = std::chrono::system_clock::now();
+        auto time_t_now = std::chrono::system_clock::to_time_t(now);
+        std::stringstream ss;
+        ss << std::put_time(std::localtime(&time_t_now), "%Y-%m-%d %H:%M:%S");
+
+        std::cerr << "[" << ss.str() << "] " << callbackType << " 回调函数发生未知异常" << std::endl;
+    }
+}
+
+} // namespace network
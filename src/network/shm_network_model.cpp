@@ -0,0 +1,269 @@
+#include "shm_network_model.hpp"
+#include "protocol/serializer.hpp"
+#include "safe_callback.hpp"
+#include <sys/uio.h>
+#include <iostream>
+#include <system_error>
+
+namespace {
+
+// 接收线程单次等待的时长，超时后检查服务端是否仍在运行
+constexpr std::chrono::milliseconds RECEIVE_POLL_INTERVAL{100};
+
+}  // namespace
+
+namespace network {
+
+ShmNetworkModel::ShmNetworkModel(INetworkCallback& callback, std::shared_ptr<IoContextPool> io_pool)
+    : callback_(callback), io_pool_(std::move(io_pool)) {
+}
+
+ShmNetworkModel::~ShmNetworkModel() {
+    std::thread receiver;
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        receiver = stopReceiver();
+    }
+    if (receiver.joinable()) {
+        receiver.join();
+    }
+}
+
+void ShmNetworkModel::setConnectionTimeout(std::chrono::milliseconds timeout) {
+    connection_timeout_ = timeout;
+}
+
+void ShmNetworkModel::setThreadConfigurator(std::shared_ptr<ThreadConfigurator> threads) {
+    threads_ = std::move(threads);
+}
+
+bool ShmNetworkModel::connect(const std::string& host, uint16_t /*port*/) {
+    std::unique_lock<std::mutex> lock(state_mutex_);
+
+    while (true) {
+        // 如果已经连接，直接返回成功
+        if (connected_) {
+            return true;
+        }
+
+        if (std::this_thread::get_id() == receive_thread_.get_id()) {
+            std::cerr << "连接失败: 不能在接收线程中重新连接" << std::endl;
+            return false;
+        }
+
+        // 清理上一次连接残留的接收线程，等待期间其他线程可能已重新连接，因此再次检查
+        std::thread previous = stopReceiver();
+        if (!previous.joinable()) {
+            break;
+        }
+        lock.unlock();
+        previous.join();
+        lock.lock();
+    }
+
+    std::shared_ptr<ShmSegment> segment;
+    try {
+        segment = ShmSegment::open(host);
+    } catch (const std::system_error& e) {
+        std::cerr << "连接失败: " << e.what() << std::endl;
+        return false;
+    }
+
+    if (!segment->serverAlive()) {
+        std::cerr << "连接失败: 共享内存段 " << host << " 的服务端未运行" << std::endl;
+        return false;
+    }
+
+    uint32_t expected = 0;
+    if (!segment->header().client_attached.compare_exchange_strong(expected, 1)) {
+        std::cerr << "连接失败: 共享内存段 " << host << " 已有客户端挂接" << std::endl;
+        return false;
+    }
+
+    // 丢弃上一个客户端残留的应答
+    segment->toClient().discard();
+
+    receiver_ = std::make_shared<Receiver>(segment);
+    {
+        std::lock_guard<std::mutex> send_lock(send_mutex_);
+        segment_ = std::move(segment);
+    }
+    connected_ = true;
+    receive_thread_ = std::thread([this, receiver = receiver_]() { receiveLoop(*receiver); });
+    if (threads_) {
+        threads_->apply(receive_thread_, "shm");
+    }
+    return true;
+}
+
+void ShmNetworkModel::connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) {
+    // 挂接不会阻塞，放到IO线程中执行只是为了与其他实现一样异步调用回调
+    boost::asio::post(io_pool_->context(),
+                      [this, self = shared_from_this(), host, port, callback = std::move(callback)]() {
+        bool connected = connect(host, port);
+        if (callback) {
+            safeCallback(callback, "连接结果", connected);
+        }
+    });
+}
+
+void ShmNetworkModel::disconnect() {
+    try {
+        std::thread receiver;
+        {
+            std::lock_guard<std::mutex> lock(state_mutex_);
+            receiver = stopReceiver();
+        }
+        if (receiver.joinable()) {
+            receiver.join();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "断开连接异常: " << e.what() << std::endl;
+    }
+}
+
+std::thread ShmNetworkModel::stopReceiver() {
+    connected_ = false;
+    if (receiver_) {
+        receiver_->stop = true;
+        receiver_.reset();
+    }
+
+    {
+        // 接收线程持有段的共享引用，这里只脱离挂接，段映射在线程退出后释放
+        std::lock_guard<std::mutex> send_lock(send_mutex_);
+        if (segment_) {
+            segment_->header().client_attached.store(0);
+            segment_->toClient().wakeConsumer();
+            segment_.reset();
+        }
+    }
+
+    // 在接收线程的回调中断开或析构时无法等待自身，线程在回调返回后发现已停止而退出
+    if (std::this_thread::get_id() == receive_thread_.get_id()) {
+        receive_thread_.detach();
+        return std::thread();
+    }
+    return std::move(receive_thread_);
+}
+
+void ShmNetworkModel::connectionLost(ShmSegment& segment, const char* reason) {
+    // 已经断开时不重复通知
+    if (!connected_.exchange(false)) {
+        return;
+    }
+    std::cerr << reason << std::endl;
+    segment.header().client_attached.store(0);
+
+    safeCallback(
+        [this]() {
+            callback_.onConnectionStateChanged(robotserver_sdk::ConnectionState::DISCONNECTED);
+        },
+        "连接状态变化"
+    );
+}
+
+bool ShmNetworkModel::isConnected() const {
+    return connected_;
+}
+
+void ShmNetworkModel::receiveLoop(Receiver& receiver) {
+    // 本对象可能在回调中被释放，stop 置位后只访问共享的接收状态
+    ShmSegment& segment = *receiver.segment;
+    ShmRing& ring = segment.toClient();
+    protocol::FrameDecoder& decoder = receiver.decoder;
+    protocol::Serializer serializer;
+
+    while (!receiver.stop) {
+        if (!ring.waitReadable(RECEIVE_POLL_INTERVAL)) {
+            if (!receiver.stop && !segment.serverAlive()) {
+                connectionLost(segment, "接收数据错误: 共享内存段的服务端已退出");
+                return;
+            }
+            continue;
+        }
+        // 断开后段可能已被新的连接重新挂接，不再读取其中的数据
+        if (receiver.stop) {
+            break;
+        }
+
+        // 直接读入帧解码器的环形缓冲区
+        std::size_t writable = 0;
+        char* buffer = decoder.prepare(writable);
+        decoder.commit(ring.read(buffer, writable));
+
+        // 取出所有完整的帧，回调中可能断开连接
+        protocol::FrameView frame;
+        while (!receiver.stop && decoder.nextFrame(frame)) {
+            auto message = serializer.deserializeFrame(frame.header, frame.body, frame.size);
+            if (!message) {
+                continue;
+            }
+            safeCallback(
+                [this](std::unique_ptr<protocol::IMessage>& msg) {
+                    callback_.onMessageReceived(std::move(msg));
+                },
+                "网络消息接收",
+                message
+            );
+        }
+    }
+}
+
+bool ShmNetworkModel::sendMessage(const protocol::IMessage& message) {
+    if (!isConnected()) {
+        return false;
+    }
+
+    try {
+        // 序列化消息，协议头和消息体分别拷贝进环，避免拼接；消息体拷贝进环后即可复用，每个发送线程保留一个缓冲区
+        thread_local protocol::SerializedFrame frame;
+        protocol::Serializer serializer;
+        serializer.serializeFrame(message, frame);
+        iovec iov[2] = {
+            {&frame.header, protocol::PROTOCOL_HEADER_SIZE},
+            {const_cast<char*>(frame.body.data()), frame.body.size()},
+        };
+        std::size_t bytes = protocol::PROTOCOL_HEADER_SIZE + frame.body.size();
+
+        std::lock_guard<std::mutex> send_lock(send_mutex_);
+        auto deadline = std::chrono::steady_clock::now() + connection_timeout_;
+        while (isConnected() && segment_) {
+            ShmRing& ring = segment_->toServer();
+            if (ring.tryWrite(iov, 2)) {
+                frames_sent_.fetch_add(1, std::memory_order_relaxed);
+                bytes_sent_.fetch_add(bytes, std::memory_order_relaxed);
+                return true;
+            }
+
+            // 环满时等待服务端读取
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline || !segment_->serverAlive()) {
+                std::cerr << "发送消息失败: 共享内存环已满" << std::endl;
+                return false;
+            }
+            ring.waitWritable(bytes, std::min(RECEIVE_POLL_INTERVAL,
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now) + std::chrono::milliseconds(1)));
+        }
+        return false;
+    } catch (const std::exception& e) {
+        std::cerr << "发送消息异常: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void ShmNetworkModel::detachCallback() {
+    callback_.close();
+}
+
+robotserver_sdk::ConnectionStatistics ShmNetworkModel::getStatistics() const {
+    robotserver_sdk::ConnectionStatistics stats;
+    // 每个帧直接写入环，没有发送队列
+    stats.framesSent = frames_sent_.load(std::memory_order_relaxed);
+    stats.writeOperations = stats.framesSent;
+    stats.bytesSent = bytes_sent_.load(std::memory_order_relaxed);
+    stats.maxFramesPerWrite = stats.framesSent > 0 ? 1 : 0;
+    return stats;
+}
+
+} // namespace network
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "base_network_model.hpp"
+#include "callback_gate.hpp"
+#include "io_context_pool.hpp"
+#include "shm_ring.hpp"
+#include "thread_settings.hpp"
+#include "protocol/frame_decoder.hpp"
+#include "types.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace network {
+
+/**
+ * @brief 基于共享内存环的网络模型实现，用于同一主机上的仿真器
+ *
+ * 服务端（仿真器）用 ShmSegment::create 创建POSIX共享内存段，SDK按段名挂接。
+ * 帧格式与TCP相同（ProtocolHeader + XML消息体），发送时协议头和消息体直接拷贝进
+ * 客户端→服务端环，不经过socket；接收由一个专用线程从服务端→客户端环读入 FrameDecoder，
+ * 没有数据时先自旋再通过futex休眠。
+ *
+ * 同一时刻一个段只允许一个客户端挂接；服务端退出（段中的进程号清零或进程不存在）时
+ * 按连接丢失处理。必须通过 std::make_shared 创建。
+ */
+class ShmNetworkModel : public BaseNetworkModel,
+                        public std::enable_shared_from_this<ShmNetworkModel> {
+public:
+    /**
+     * @brief 构造函数
+     * @param callback 网络回调接口
+     * @param io_pool 用于执行异步连接的IO线程池
+     */
+    ShmNetworkModel(INetworkCallback& callback, std::shared_ptr<IoContextPool> io_pool);
+
+    /**
+     * @brief 析构函数
+     */
+    ~ShmNetworkModel() override;
+
+    /**
+     * @brief 挂接到服务端创建的共享内存段
+     * @param host 共享内存段名
+     * @param port 未使用
+     * @return 是否连接成功
+     */
+    bool connect(const std::string& host, uint16_t port) override;
+
+    /**
+     * @brief 异步连接，在IO线程中挂接共享内存段后调用回调
+     * @param host 共享内存段名
+     * @param port 未使用
+     * @param callback 连接完成后调用
+     */
+    void connectAsync(const std::string& host, uint16_t port, ConnectCallback callback) override;
+
+    /**
+     * @brief 断开连接
+     */
+    void disconnect() override;
+
+    /**
+     * @brief 检查是否已连接
+     * @return 是否已连接
+     */
+    bool isConnected() const override;
+
+    /**
+     * @brief 发送消息
+     * @param message 要发送的消息
+     * @return 是否发送成功
+     *
+     * 在调用线程中直接写入共享内存环；环满时等待服务端读取，最长等待连接超时时间。
+     */
+    bool sendMessage(const protocol::IMessage& message) override;
+
+    /**
+     * @brief 获取连接统计信息
+     * @return 统计信息快照
+     */
+    robotserver_sdk::ConnectionStatistics getStatistics() const override;
+
+    /**
+     * @brief 断开与上层回调的联系，见 BaseNetworkModel::detachCallback()
+     */
+    void detachCallback() override;
+
+    /**
+     * @brief 设置连接超时时间（同时作为环满时发送的最长等待时间）
+     * @param timeout 超时时间（毫秒）
+     */
+    void setConnectionTimeout(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief 设置接收线程的配置（连接前调用）
+     * @param threads 线程配置
+     */
+    void setThreadConfigurator(std::shared_ptr<ThreadConfigurator> threads);
+
+private:
+    // 接收线程与本对象共享，本对象在接收线程的回调中析构时线程分离后仍可安全访问
+    struct Receiver {
+        explicit Receiver(std::shared_ptr<ShmSegment> attached) : segment(std::move(attached)) {}
+
+        std::shared_ptr<ShmSegment> segment; // 段映射在接收线程退出后才会释放
+        std::atomic<bool> stop{false};       // 通知接收线程退出，置位后线程不再访问本对象
+        protocol::FrameDecoder decoder;      // 只在接收线程中访问
+    };
+
+    /**
+     * @brief 接收线程主循环
+     * @param receiver 本次连接的接收状态
+     */
+    void receiveLoop(Receiver& receiver);
+
+    /**
+     * @brief 通知接收线程退出并脱离共享内存段（调用方持有 state_mutex_）
+     * @return 需要等待结束的接收线程；在接收线程自身中调用时线程被分离，返回空线程
+     *
+     * 调用方应释放 state_mutex_ 后再等待返回的线程，接收线程的回调中可能需要获取该锁。
+     */
+    std::thread stopReceiver();
+
+    /**
+     * @brief 服务端退出导致连接丢失：脱离共享内存段并通知回调（在接收线程中调用）
+     * @param segment 本次连接的共享内存段
+     * @param reason 日志中的原因
+     */
+    void connectionLost(ShmSegment& segment, const char* reason);
+
+    GatedNetworkCallback callback_; // 经由闸门回调上层
+    std::shared_ptr<IoContextPool> io_pool_;
+    std::chrono::milliseconds connection_timeout_{5000}; // 连接超时时间，默认5秒
+    std::shared_ptr<ThreadConfigurator> threads_;        // 接收线程配置，可为空
+    std::atomic<bool> connected_{false};
+
+    std::mutex state_mutex_;               // 保护接收线程和接收状态，串行化连接与断开
+    std::mutex send_mutex_;                // 串行化多个发送线程（环只允许单生产者），同时保护段的挂接状态
+    std::shared_ptr<ShmSegment> segment_;
+    std::shared_ptr<Receiver> receiver_;
+    std::thread receive_thread_;
+
+    std::atomic<uint64_t> frames_sent_{0};
+    std::atomic<uint64_t> bytes_sent_{0};
+};
+
+} // namespace network
@@ -0,0 +1,287 @@
+#include "shm_ring.hpp"
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <system_error>
+#include <thread>
+
+namespace {
+
+// 进入futex休眠前的自旋次数，对方通常在几微秒内就会推进位置
+constexpr int SPIN_ITERATIONS = 2000;
+
+// 头部占用的字节数，数据区从页边界开始
+constexpr std::size_t HEADER_SPACE = (sizeof(network::ShmSegmentHeader) + 4095) & ~std::size_t(4095);
+
+// 环的最小容量，保证任意完整帧（16 + 65535字节）都能一次写入
+constexpr std::size_t MIN_RING_CAPACITY = 128 * 1024;
+
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+// 共享内存中的futex字需要跨进程唤醒，不能使用 FUTEX_PRIVATE_FLAG
+void futexWait(std::atomic<uint32_t>& word, uint32_t expected, std::chrono::nanoseconds timeout) {
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+    ts.tv_nsec = static_cast<long>(timeout.count() % 1000000000);
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, &ts, nullptr, 0);
+}
+
+void futexWake(std::atomic<uint32_t>& word) {
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+// 对方推进位置后，如果等待标志已置位则清零并唤醒
+void wakeIfWaiting(std::atomic<uint32_t>& waiting) {
+    if (waiting.load(std::memory_order_seq_cst) != 0 && waiting.exchange(0, std::memory_order_seq_cst) != 0) {
+        futexWake(waiting);
+    }
+}
+
+/**
+ * @brief 先自旋再休眠，直到条件满足或超时
+ * @param waiting 本方的等待标志（futex字）
+ * @param ready 条件判断
+ */
+template<typename Ready>
+bool waitUntil(std::atomic<uint32_t>& waiting, std::chrono::milliseconds timeout, Ready ready) {
+    // 单核时自旋只会占住对方需要的CPU
+    static const int spin_iterations = std::thread::hardware_concurrency() > 1 ? SPIN_ITERATIONS : 0;
+    for (int i = 0; i < spin_iterations; ++i) {
+        if (ready()) {
+            return true;
+        }
+        cpuRelax();
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        // 先置等待标志再检查条件，与对方“先推进位置再检查标志”配对，不会丢失唤醒
+        waiting.store(1, std::memory_order_seq_cst);
+        if (ready()) {
+            waiting.store(0, std::memory_order_relaxed);
+            return true;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            waiting.store(0, std::memory_order_relaxed);
+            return false;
+        }
+        futexWait(waiting, 1, deadline - now);
+    }
+}
+
+std::size_t roundUpPowerOfTwo(std::size_t value) {
+    std::size_t result = MIN_RING_CAPACITY;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+std::string shmPath(const std::string& name) {
+    return name.empty() || name[0] != '/' ? "/" + name : name;
+}
+
+}  // namespace
+
+namespace network {
+
+ShmRing::ShmRing(ShmRingControl* control, char* data, std::size_t capacity)
+    : control_(control), data_(data), capacity_(capacity) {
+}
+
+bool ShmRing::tryWrite(const iovec* iov, std::size_t count) {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        total += iov[i].iov_len;
+    }
+
+    uint64_t tail = control_->tail.load(std::memory_order_relaxed);
+    uint64_t head = control_->head.load(std::memory_order_acquire);
+    if (total > capacity_ - static_cast<std::size_t>(tail - head)) {
+        return false;
+    }
+
+    // 逐段拷贝到数据区，跨越末尾时分两次拷贝
+    uint64_t position = tail;
+    for (std::size_t i = 0; i < count; ++i) {
+        const char* source = static_cast<const char*>(iov[i].iov_base);
+        std::size_t remaining = iov[i].iov_len;
+        while (remaining > 0) {
+            std::size_t offset = static_cast<std::size_t>(position & (capacity_ - 1));
+            std::size_t chunk = std::min(remaining, capacity_ - offset);
+            std::memcpy(data_ + offset, source, chunk);
+            source += chunk;
+            remaining -= chunk;
+            position += chunk;
+        }
+    }
+
+    control_->tail.store(position, std::memory_order_seq_cst);
+    wakeIfWaiting(control_->consumer_waiting);
+    return true;
+}
+
+std::size_t ShmRing::read(char* buffer, std::size_t size) {
+    uint64_t head = control_->head.load(std::memory_order_relaxed);
+    uint64_t tail = control_->tail.load(std::memory_order_acquire);
+    std::size_t available = static_cast<std::size_t>(tail - head);
+    std::size_t total = std::min(size, available);
+    if (total == 0) {
+        return 0;
+    }
+
+    std::size_t offset = static_cast<std::size_t>(head & (capacity_ - 1));
+    std::size_t first = std::min(total, capacity_ - offset);
+    std::memcpy(buffer, data_ + offset, first);
+    std::memcpy(buffer + first, data_, total - first);
+
+    control_->head.store(head + total, std::memory_order_seq_cst);
+    wakeIfWaiting(control_->producer_waiting);
+    return total;
+}
+
+void ShmRing::discard() {
+    control_->head.store(control_->tail.load(std::memory_order_acquire), std::memory_order_seq_cst);
+    wakeIfWaiting(control_->producer_waiting);
+}
+
+std::size_t ShmRing::readable() const {
+    return static_cast<std::size_t>(control_->tail.load(std::memory_order_seq_cst) -
+                                    control_->head.load(std::memory_order_relaxed));
+}
+
+bool ShmRing::waitReadable(std::chrono::milliseconds timeout) {
+    return waitUntil(control_->consumer_waiting, timeout, [this]() {
+        return readable() > 0;
+    });
+}
+
+bool ShmRing::waitWritable(std::size_t bytes, std::chrono::milliseconds timeout) {
+    return waitUntil(control_->producer_waiting, timeout, [this, bytes]() {
+        uint64_t used = control_->tail.load(std::memory_order_relaxed) -
+                        control_->head.load(std::memory_order_seq_cst);
+        return capacity_ - static_cast<std::size_t>(used) >= bytes;
+    });
+}
+
+void ShmRing::wakeConsumer() {
+    control_->consumer_waiting.store(0, std::memory_order_seq_cst);
+    futexWake(control_->consumer_waiting);
+}
+
+std::unique_ptr<ShmSegment> ShmSegment::create(const std::string& name, std::size_t ring_capacity) {
+    std::string path = shmPath(name);
+    std::size_t capacity = roundUpPowerOfTwo(ring_capacity);
+    std::size_t size = HEADER_SPACE + 2 * capacity;
+
+    // 上次异常退出可能留下同名的段，删除后重新创建
+    ::shm_unlink(path.c_str());
+    int fd = ::shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "创建共享内存段失败: " + path);
+    }
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        int error = errno;
+        ::close(fd);
+        ::shm_unlink(path.c_str());
+        throw std::system_error(error, std::generic_category(), "设置共享内存段大小失败: " + path);
+    }
+    void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int error = errno;
+    ::close(fd);
+    if (memory == MAP_FAILED) {
+        ::shm_unlink(path.c_str());
+        throw std::system_error(error, std::generic_category(), "映射共享内存段失败: " + path);
+    }
+
+    // 新建的共享内存已清零，这里显式构造头部
+    auto* header = new (memory) ShmSegmentHeader();
+    header->magic = SHM_SEGMENT_MAGIC;
+    header->version = SHM_SEGMENT_VERSION;
+    header->ring_capacity = capacity;
+    header->client_attached.store(0, std::memory_order_relaxed);
+    for (auto& ring : header->rings) {
+        ring.head.store(0, std::memory_order_relaxed);
+        ring.tail.store(0, std::memory_order_relaxed);
+        ring.consumer_waiting.store(0, std::memory_order_relaxed);
+        ring.producer_waiting.store(0, std::memory_order_relaxed);
+    }
+    header->server_pid.store(static_cast<int32_t>(::getpid()), std::memory_order_release);
+
+    return std::unique_ptr<ShmSegment>(new ShmSegment(path, memory, size, true));
+}
+
+std::unique_ptr<ShmSegment> ShmSegment::open(const std::string& name) {
+    std::string path = shmPath(name);
+    int fd = ::shm_open(path.c_str(), O_RDWR | O_CLOEXEC, 0);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "打开共享内存段失败: " + path);
+    }
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < HEADER_SPACE) {
+        ::close(fd);
+        throw std::system_error(EPROTO, std::generic_category(), "共享内存段大小无效: " + path);
+    }
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int error = errno;
+    ::close(fd);
+    if (memory == MAP_FAILED) {
+        throw std::system_error(error, std::generic_category(), "映射共享内存段失败: " + path);
+    }
+
+    auto* header = static_cast<ShmSegmentHeader*>(memory);
+    std::size_t capacity = static_cast<std::size_t>(header->ring_capacity);
+    if (header->magic != SHM_SEGMENT_MAGIC || header->version != SHM_SEGMENT_VERSION ||
+        capacity < MIN_RING_CAPACITY || (capacity & (capacity - 1)) != 0 || size < HEADER_SPACE + 2 * capacity) {
+        ::munmap(memory, size);
+        throw std::system_error(EPROTO, std::generic_category(), "共享内存段格式不匹配: " + path);
+    }
+
+    return std::unique_ptr<ShmSegment>(new ShmSegment(path, memory, size, false));
+}
+
+ShmSegment::ShmSegment(std::string name, void* memory, std::size_t size, bool owner)
+    : name_(std::move(name)), memory_(memory), size_(size), owner_(owner),
+      header_(static_cast<ShmSegmentHeader*>(memory)) {
+    std::size_t capacity = static_cast<std::size_t>(header_->ring_capacity);
+    char* data = static_cast<char*>(memory_) + HEADER_SPACE;
+    to_server_ = ShmRing(&header_->rings[0], data, capacity);
+    to_client_ = ShmRing(&header_->rings[1], data + capacity, capacity);
+}
+
+ShmSegment::~ShmSegment() {
+    if (owner_) {
+        // 通知客户端服务端已退出，唤醒其接收线程
+        header_->server_pid.store(0, std::memory_order_seq_cst);
+        to_client_.wakeConsumer();
+        ::shm_unlink(name_.c_str());
+    }
+    ::munmap(memory_, size_);
+}
+
+bool ShmSegment::serverAlive() const {
+    int32_t pid = header_->server_pid.load(std::memory_order_acquire);
+    if (pid == 0) {
+        return false;
+    }
+    return ::kill(pid, 0) == 0 || errno == EPERM;
+}
+
+} // namespace network
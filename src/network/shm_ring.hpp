@@ -0,0 +1,180 @@
+#pragma once
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace network {
+
+/**
+ * @brief 共享内存中一个单生产者单消费者环的控制块
+ *
+ * head / tail 是单调递增的字节位置，取模容量后得到数据区偏移；
+ * 生产者和消费者各写一个位置，放在不同缓存行上避免伪共享。
+ * 等待标志同时作为futex字：等待方置1后休眠，对方推进位置后发现标志为1则清零并唤醒。
+ */
+struct ShmRingControl {
+    alignas(64) std::atomic<uint64_t> head;             ///< 消费者已读到的位置
+    alignas(64) std::atomic<uint64_t> tail;             ///< 生产者已写到的位置
+    alignas(64) std::atomic<uint32_t> consumer_waiting; ///< 消费者正在等待数据
+    std::atomic<uint32_t> producer_waiting;             ///< 生产者正在等待空间
+};
+
+/**
+ * @brief 共享内存段头部
+ *
+ * 段布局：头部（按页对齐）之后依次是客户端→服务端、服务端→客户端两个环的数据区。
+ * 服务端（仿真器）创建并初始化段，SDK作为唯一的客户端挂接。
+ */
+struct ShmSegmentHeader {
+    uint32_t magic;                          ///< SHM_SEGMENT_MAGIC
+    uint32_t version;                        ///< SHM_SEGMENT_VERSION
+    uint64_t ring_capacity;                  ///< 每个环的数据区字节数（2的幂）
+    std::atomic<int32_t> server_pid;         ///< 服务端进程号，服务端退出时置0
+    std::atomic<uint32_t> client_attached;   ///< 是否已有客户端挂接
+    ShmRingControl rings[2];                 ///< 0: 客户端→服务端，1: 服务端→客户端
+};
+
+constexpr uint32_t SHM_SEGMENT_MAGIC = 0x52534d52;  // "RMSR"
+constexpr uint32_t SHM_SEGMENT_VERSION = 1;
+
+/**
+ * @brief 共享内存中的单生产者单消费者字节环
+ *
+ * 写入以完整的帧为单位（全部写入或不写），因此消费者看到的数据总是在帧边界上结束，
+ * 协议帧的解析与TCP字节流相同。等待时先自旋一小段时间，再通过futex休眠，
+ * 对方推进位置后只在有等待者时才执行唤醒系统调用。
+ * 多个生产者线程需要由调用方加锁串行化。
+ */
+class ShmRing {
+public:
+    ShmRing() = default;
+
+    /**
+     * @brief 构造函数
+     * @param control 共享内存中的控制块
+     * @param data 共享内存中的数据区
+     * @param capacity 数据区字节数（2的幂）
+     */
+    ShmRing(ShmRingControl* control, char* data, std::size_t capacity);
+
+    /**
+     * @brief 生产者：写入一段完整的数据
+     * @param iov 数据的缓冲区序列
+     * @param count 缓冲区个数
+     * @return 空间足够时写入并返回true，否则不写入并返回false
+     */
+    bool tryWrite(const iovec* iov, std::size_t count);
+
+    /**
+     * @brief 消费者：读取最多 size 字节
+     * @return 实际读取的字节数
+     */
+    std::size_t read(char* buffer, std::size_t size);
+
+    /**
+     * @brief 消费者：丢弃所有未读数据
+     */
+    void discard();
+
+    /**
+     * @brief 可读的字节数
+     */
+    std::size_t readable() const;
+
+    /**
+     * @brief 消费者：等待数据到达
+     * @param timeout 最长等待时间
+     * @return 是否有数据可读
+     */
+    bool waitReadable(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief 生产者：等待可以写入 bytes 字节
+     * @param bytes 需要的空间
+     * @param timeout 最长等待时间
+     * @return 是否有足够的空间
+     */
+    bool waitWritable(std::size_t bytes, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief 唤醒在本环上等待数据的消费者（用于停止接收线程）
+     */
+    void wakeConsumer();
+
+    /**
+     * @brief 数据区字节数
+     */
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    ShmRingControl* control_ = nullptr;
+    char* data_ = nullptr;
+    std::size_t capacity_ = 0;
+};
+
+/**
+ * @brief 映射到本进程的共享内存段
+ *
+ * 服务端用 create() 创建（析构时删除段名），客户端用 open() 打开已有的段。
+ */
+class ShmSegment {
+public:
+    /**
+     * @brief 创建并初始化共享内存段（服务端）
+     * @param name 段名（不含前导'/'）
+     * @param ring_capacity 每个环的数据区字节数，向上取整为2的幂
+     * @throws std::system_error 创建或映射失败
+     */
+    static std::unique_ptr<ShmSegment> create(const std::string& name, std::size_t ring_capacity);
+
+    /**
+     * @brief 打开服务端已创建的共享内存段（客户端）
+     * @param name 段名（不含前导'/'）
+     * @throws std::system_error 段不存在、映射失败或版本不匹配
+     */
+    static std::unique_ptr<ShmSegment> open(const std::string& name);
+
+    ~ShmSegment();
+
+    ShmSegment(const ShmSegment&) = delete;
+    ShmSegment& operator=(const ShmSegment&) = delete;
+
+    /**
+     * @brief 段头部
+     */
+    ShmSegmentHeader& header() { return *header_; }
+
+    /**
+     * @brief 客户端→服务端的环
+     */
+    ShmRing& toServer() { return to_server_; }
+
+    /**
+     * @brief 服务端→客户端的环
+     */
+    ShmRing& toClient() { return to_client_; }
+
+    /**
+     * @brief 服务端进程是否仍在运行
+     */
+    bool serverAlive() const;
+
+private:
+    ShmSegment(std::string name, void* memory, std::size_t size, bool owner);
+
+    std::string name_;
+    void* memory_;
+    std::size_t size_;
+    bool owner_;
+    ShmSegmentHeader* header_;
+    ShmRing to_server_;
+    ShmRing to_client_;
+};
+
+} // namespace network
@@ -0,0 +1,100 @@
+#include "socket_address.hpp"
+#include <netdb.h>
+#include <sys/un.h>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+/**
+ * @brief 填充Unix域socket地址，@开头的名字使用Linux抽象命名空间
+ */
+bool resolveUnixEndpoint(const std::string& path, sockaddr_storage& address, socklen_t& length) {
+    sockaddr_un* unix_address = reinterpret_cast<sockaddr_un*>(&address);
+    if (path.empty() || path.size() >= sizeof(unix_address->sun_path)) {
+        std::cerr << "地址解析失败: Unix域socket路径为空或过长: " << path << std::endl;
+        return false;
+    }
+
+    std::memset(&address, 0, sizeof(address));
+    unix_address->sun_family = AF_UNIX;
+    std::memcpy(unix_address->sun_path, path.data(), path.size());
+    if (path[0] == '@') {
+        // 抽象命名空间的地址长度不含结尾的0
+        unix_address->sun_path[0] = '\0';
+        length = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + path.size());
+    } else {
+        length = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + path.size() + 1);
+    }
+    return true;
+}
+
+/**
+ * @brief 调用getaddrinfo解析TCP地址
+ * @return getaddrinfo的返回值，0表示成功
+ */
+int lookupEndpoint(const std::string& host, uint16_t port, int flags, sockaddr_storage& address, socklen_t& length) {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_NUMERICSERV | flags;
+
+    addrinfo* result = nullptr;
+    int rc = getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &result);
+    if (rc != 0 || !result) {
+        return rc != 0 ? rc : EAI_NONAME;
+    }
+
+    std::memcpy(&address, result->ai_addr, result->ai_addrlen);
+    length = result->ai_addrlen;
+    freeaddrinfo(result);
+    return 0;
+}
+
+}  // namespace
+
+namespace network {
+
+bool isUnixEndpoint(const std::string& host) {
+    return host.compare(0, sizeof(UNIX_ENDPOINT_PREFIX) - 1, UNIX_ENDPOINT_PREFIX) == 0;
+}
+
+bool resolveEndpoint(const std::string& host, uint16_t port, sockaddr_storage& address, socklen_t& length) {
+    if (isUnixEndpoint(host)) {
+        return resolveUnixEndpoint(host.substr(sizeof(UNIX_ENDPOINT_PREFIX) - 1), address, length);
+    }
+
+    int rc = lookupEndpoint(host, port, 0, address, length);
+    if (rc != 0) {
+        std::cerr << "地址解析失败: " << gai_strerror(rc) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+HostResolver::RequestId resolveEndpointAsync(HostResolver& resolver, const std::string& host, uint16_t port,
+                                             ResolveCallback callback) {
+    sockaddr_storage address{};
+    socklen_t length = 0;
+    if (isUnixEndpoint(host)) {
+        bool resolved = resolveEndpoint(host, port, address, length);
+        callback(resolved, address, length);
+        return 0;
+    }
+
+    // 先按数字地址解析，不涉及DNS查询
+    int rc = lookupEndpoint(host, port, AI_NUMERICHOST, address, length);
+    if (rc != EAI_NONAME) {
+        if (rc != 0) {
+            std::cerr << "地址解析失败: " << gai_strerror(rc) << std::endl;
+        }
+        callback(rc == 0, address, length);
+        return 0;
+    }
+
+    // 主机名的DNS查询可能阻塞数秒，交给解析线程
+    return resolver.resolve(host, port, std::move(callback));
+}
+
+} // namespace network
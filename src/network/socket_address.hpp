@@ -0,0 +1,48 @@
+#pragma once
+
+#include "host_resolver.hpp"
+#include <sys/socket.h>
+#include <cstdint>
+#include <string>
+
+namespace network {
+
+/**
+ * @brief Unix域socket地址的前缀，如 unix:///run/robotserver.sock
+ */
+constexpr const char UNIX_ENDPOINT_PREFIX[] = "unix://";
+
+/**
+ * @brief 是否为Unix域socket地址（unix:///path 或抽象命名空间 unix://@name）
+ * @param host 主机地址
+ */
+bool isUnixEndpoint(const std::string& host);
+
+/**
+ * @brief 解析服务端地址，取第一个可用的地址
+ * @param host 主机地址（IP地址不涉及DNS查询），或 unix:///path 形式的Unix域socket路径
+ * @param port 端口号，Unix域socket忽略
+ * @param address 输出参数，解析得到的地址
+ * @param length 输出参数，地址长度
+ * @return 是否解析成功，失败时记录日志
+ *
+ * 在调用线程中同步解析，主机名需要DNS查询时会阻塞，事件循环中使用 resolveEndpointAsync。
+ */
+bool resolveEndpoint(const std::string& host, uint16_t port, sockaddr_storage& address, socklen_t& length);
+
+/**
+ * @brief 异步解析服务端地址，取第一个可用的地址
+ * @param resolver 查询主机名的解析线程
+ * @param host 主机地址，或 unix:///path 形式的Unix域socket路径
+ * @param port 端口号，Unix域socket忽略
+ * @param callback 解析完成后调用
+ * @return 解析请求编号，可用于 HostResolver::cancel()；已在调用线程中完成时为0
+ *
+ * IP地址和Unix域socket地址不涉及DNS查询，在调用线程中直接解析并调用回调；
+ * 主机名交给 resolver 查询DNS，完成后在解析线程中调用回调。
+ * 供不使用Asio解析器的传输层使用，调用方负责解析的超时。
+ */
+HostResolver::RequestId resolveEndpointAsync(HostResolver& resolver, const std::string& host, uint16_t port,
+                                             ResolveCallback callback);
+
+} // namespace network
@@ -0,0 +1,80 @@
+#include "socket_options.hpp"
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+// 设置一个int类型的选项，失败时记录日志
+bool setIntOption(int fd, int level, int name, int value, const char* description) {
+    if (setsockopt(fd, level, name, &value, sizeof(value)) != 0) {
+        std::cerr << "设置socket选项 " << description << "=" << value << " 失败: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// 是否为TCP socket（IPv4 / IPv6）
+bool isTcpSocket(int fd) {
+    sockaddr_storage address{};
+    socklen_t length = sizeof(address);
+    if (getsockname(fd, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        return true;
+    }
+    return address.ss_family == AF_INET || address.ss_family == AF_INET6;
+}
+
+}  // namespace
+
+namespace network {
+
+bool applySocketOptions(int fd, const robotserver_sdk::SocketOptions& options) {
+    bool ok = true;
+
+    if (options.sendBufferSize > 0) {
+        ok &= setIntOption(fd, SOL_SOCKET, SO_SNDBUF, options.sendBufferSize, "SO_SNDBUF");
+    }
+    if (options.receiveBufferSize > 0) {
+        ok &= setIntOption(fd, SOL_SOCKET, SO_RCVBUF, options.receiveBufferSize, "SO_RCVBUF");
+    }
+
+    // Unix域socket没有Nagle算法、TCP keepalive和网卡队列，只设置缓冲区大小
+    if (!isTcpSocket(fd)) {
+        return ok;
+    }
+
+    ok &= setIntOption(fd, IPPROTO_TCP, TCP_NODELAY, options.noDelay ? 1 : 0, "TCP_NODELAY");
+
+    // 未开启时不设置，保持系统默认值
+    if (options.keepAlive) {
+        ok &= setIntOption(fd, SOL_SOCKET, SO_KEEPALIVE, 1, "SO_KEEPALIVE");
+#ifdef TCP_KEEPIDLE
+        if (options.keepAliveIdle.count() > 0) {
+            ok &= setIntOption(fd, IPPROTO_TCP, TCP_KEEPIDLE, static_cast<int>(options.keepAliveIdle.count()), "TCP_KEEPIDLE");
+        }
+        if (options.keepAliveInterval.count() > 0) {
+            ok &= setIntOption(fd, IPPROTO_TCP, TCP_KEEPINTVL, static_cast<int>(options.keepAliveInterval.count()), "TCP_KEEPINTVL");
+        }
+        if (options.keepAliveCount > 0) {
+            ok &= setIntOption(fd, IPPROTO_TCP, TCP_KEEPCNT, options.keepAliveCount, "TCP_KEEPCNT");
+        }
+#endif
+    }
+
+    if (options.busyPollMicroseconds > 0) {
+#ifdef SO_BUSY_POLL
+        // 超过 net.core.busy_read 的值需要 CAP_NET_ADMIN 权限
+        ok &= setIntOption(fd, SOL_SOCKET, SO_BUSY_POLL, options.busyPollMicroseconds, "SO_BUSY_POLL");
+#else
+        std::cerr << "当前平台不支持 SO_BUSY_POLL" << std::endl;
+        ok = false;
+#endif
+    }
+
+    return ok;
+}
+
+} // namespace network
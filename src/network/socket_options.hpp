@@ -0,0 +1,17 @@
+#pragma once
+
+#include "types.h"
+
+namespace network {
+
+/**
+ * @brief 对已连接的socket设置SdkOptions中的socket选项
+ * @param fd 原生socket描述符
+ * @param options socket选项
+ * @return 是否全部设置成功，失败的选项会记录日志，其余选项照常设置
+ *
+ * 与具体传输层实现无关，各传输层在连接建立后调用。Unix域socket只设置缓冲区大小。
+ */
+bool applySocketOptions(int fd, const robotserver_sdk::SocketOptions& options);
+
+} // namespace network
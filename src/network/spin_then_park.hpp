@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <thread>
+
+namespace network {
+
+/**
+ * @brief 忙轮询的先自旋后休眠策略
+ *
+ * 事件循环处理完事件后，在自旋时长内继续以零超时轮询，超过自旋时长仍没有新事件才阻塞等待，
+ * 省去线程休眠和被唤醒的时延，代价是空闲时也占满一个CPU核直到自旋结束。
+ * 自旋时长为0时始终阻塞等待。只在事件循环线程中使用。
+ */
+class SpinThenPark {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit SpinThenPark(std::chrono::microseconds spin) : spin_(spin) {}
+
+    /**
+     * @brief 是否启用忙轮询
+     */
+    bool enabled() const { return spin_.count() > 0; }
+
+    /**
+     * @brief 处理了事件，重新开始计算自旋时长
+     */
+    void onActivity() {
+        if (enabled()) {
+            last_activity_ = Clock::now();
+        }
+    }
+
+    /**
+     * @brief 是否仍在自旋时长内
+     */
+    bool spinning() const { return enabled() && Clock::now() - last_activity_ < spin_; }
+
+    /**
+     * @brief 本轮等待事件的超时：自旋时长内为0（不阻塞），否则为原超时
+     * @param timeout_ms 阻塞等待时的超时（毫秒），-1表示无限等待
+     */
+    int waitTimeout(int timeout_ms) const { return spinning() ? 0 : timeout_ms; }
+
+    /**
+     * @brief 自旋中一轮轮询没有事件时调用：让出CPU给同一核上的其他就绪线程（如对端进程），
+     *        独占的核上没有其他就绪线程时立即返回
+     */
+    void relax() const { std::this_thread::yield(); }
+
+private:
+    std::chrono::microseconds spin_;
+    Clock::time_point last_activity_{};
+};
+
+} // namespace network
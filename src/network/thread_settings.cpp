@@ -0,0 +1,129 @@
+#include "thread_settings.hpp"
+#include <pthread.h>
+#include <sched.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+using robotserver_sdk::ThreadSchedulingPolicy;
+using robotserver_sdk::ThreadSettingResult;
+using robotserver_sdk::ThreadStatus;
+
+namespace {
+
+// Linux 线程名最长15个字符（不含结尾的0）
+constexpr std::size_t MAX_THREAD_NAME = 15;
+
+// 记录一项设置的失败原因
+void addError(ThreadStatus& status, const char* setting, const char* reason) {
+    if (!status.error.empty()) {
+        status.error += "; ";
+    }
+    status.error += setting;
+    status.error += ": ";
+    status.error += reason;
+}
+
+void applyAffinity(pthread_t handle, const std::vector<int>& cpus, ThreadStatus& status) {
+    cpu_set_t requested;
+    CPU_ZERO(&requested);
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &requested);
+        }
+    }
+
+    int rc = CPU_COUNT(&requested) > 0 ? pthread_setaffinity_np(handle, sizeof(requested), &requested) : EINVAL;
+    if (rc != 0) {
+        status.affinityResult = ThreadSettingResult::FAILED;
+        addError(status, "CPU亲和性", std::strerror(rc));
+        return;
+    }
+
+    // 内核只保留在线的CPU，读回确认实际生效的集合
+    cpu_set_t actual;
+    CPU_ZERO(&actual);
+    rc = pthread_getaffinity_np(handle, sizeof(actual), &actual);
+    if (rc != 0 || !CPU_EQUAL(&actual, &requested)) {
+        status.affinityResult = ThreadSettingResult::FAILED;
+        addError(status, "CPU亲和性", rc != 0 ? std::strerror(rc) : "部分CPU不可用");
+        return;
+    }
+    status.affinityResult = ThreadSettingResult::APPLIED;
+}
+
+void applyScheduling(pthread_t handle, ThreadSchedulingPolicy policy, int priority, ThreadStatus& status) {
+    int requested_policy = policy == ThreadSchedulingPolicy::FIFO ? SCHED_FIFO : SCHED_RR;
+    sched_param param{};
+    param.sched_priority = priority;
+
+    int rc = pthread_setschedparam(handle, requested_policy, &param);
+    if (rc != 0) {
+        status.schedulingResult = ThreadSettingResult::FAILED;
+        addError(status, "调度策略", std::strerror(rc));
+        return;
+    }
+
+    int actual_policy = 0;
+    sched_param actual{};
+    rc = pthread_getschedparam(handle, &actual_policy, &actual);
+    if (rc != 0 || actual_policy != requested_policy || actual.sched_priority != priority) {
+        status.schedulingResult = ThreadSettingResult::FAILED;
+        addError(status, "调度策略", rc != 0 ? std::strerror(rc) : "读回的策略或优先级与配置不同");
+        return;
+    }
+    status.schedulingResult = ThreadSettingResult::APPLIED;
+}
+
+}  // namespace
+
+namespace network {
+
+ThreadConfigurator::ThreadConfigurator(const robotserver_sdk::ThreadOptions& options)
+    : options_(options) {
+}
+
+void ThreadConfigurator::apply(std::thread& thread, const std::string& role) {
+    ThreadStatus status;
+    // 超长时截断前缀，保留用途，使各线程的名字仍然不同
+    status.name = role;
+    if (!options_.namePrefix.empty() && role.size() + 1 < MAX_THREAD_NAME) {
+        status.name = options_.namePrefix.substr(0, MAX_THREAD_NAME - role.size() - 1) + "-" + role;
+    }
+    pthread_t handle = thread.native_handle();
+
+    if (!options_.namePrefix.empty()) {
+        int rc = pthread_setname_np(handle, status.name.c_str());
+        status.nameResult = rc == 0 ? ThreadSettingResult::APPLIED : ThreadSettingResult::FAILED;
+        if (rc != 0) {
+            addError(status, "线程名", std::strerror(rc));
+        }
+    }
+    if (!options_.cpuAffinity.empty()) {
+        applyAffinity(handle, options_.cpuAffinity, status);
+    }
+    if (options_.policy != ThreadSchedulingPolicy::DEFAULT) {
+        applyScheduling(handle, options_.policy, options_.priority, status);
+    }
+
+    if (!status.error.empty()) {
+        std::cerr << "线程 " << status.name << " 设置失败: " << status.error << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto existing = std::find_if(status_.begin(), status_.end(),
+                                 [&status](const ThreadStatus& item) { return item.name == status.name; });
+    if (existing != status_.end()) {
+        *existing = std::move(status);
+    } else {
+        status_.push_back(std::move(status));
+    }
+}
+
+std::vector<ThreadStatus> ThreadConfigurator::status() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return status_;
+}
+
+} // namespace network
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "types.h"
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace network {
+
+/**
+ * @brief 对SDK创建的线程应用 ThreadOptions，并记录每项设置是否生效
+ *
+ * 由运行时持有，创建线程的一方在线程启动后立即调用 apply()。
+ * 设置后读回线程的实际属性确认生效；失败的设置会记录日志，不影响线程运行。
+ */
+class ThreadConfigurator {
+public:
+    /**
+     * @brief 构造函数
+     * @param options 线程配置
+     */
+    explicit ThreadConfigurator(const robotserver_sdk::ThreadOptions& options);
+
+    /**
+     * @brief 对刚启动的线程应用配置（任意线程可调用）
+     * @param thread 线程
+     * @param role 线程用途，用于线程名；同名线程（如重新连接后的接收线程）只保留最近一次的结果
+     */
+    void apply(std::thread& thread, const std::string& role);
+
+    /**
+     * @brief 获取已配置线程的设置结果
+     * @return 按线程启动顺序排列的结果
+     */
+    std::vector<robotserver_sdk::ThreadStatus> status() const;
+
+private:
+    robotserver_sdk::ThreadOptions options_;
+    mutable std::mutex mutex_;
+    std::vector<robotserver_sdk::ThreadStatus> status_;
+};
+
+} // namespace network
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "patrol_fields.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace protocol {
+
+/**
+ * @brief 字段描述：XML元素名 → 成员指针
+ *
+ * 消息类用静态 constexpr 函数 fieldTable() 返回由 field() 组成的 std::tuple，
+ * 序列化和反序列化都由这张表生成，元素名只写一次。
+ */
+template <typename Owner, typename Member>
+struct FieldDescriptor {
+    std::string_view tag;     ///< XML元素名
+    Member Owner::*member;    ///< 对应的成员
+};
+
+/**
+ * @brief 构造字段描述
+ * @param tag XML元素名
+ * @param member 对应的成员
+ */
+template <typename Owner, typename Member>
+constexpr FieldDescriptor<Owner, Member> field(std::string_view tag, Member Owner::*member) {
+    return FieldDescriptor<Owner, Member>{tag, member};
+}
+
+/**
+ * @brief 字段编解码：数值直接转换
+ */
+template <typename T, typename = void>
+struct FieldCodec {
+    static NumberStatus decode(std::string_view text, T& value) { return readNumber(text, value); }
+    static char* encode(char* first, const T& value) { return formatNumber(first, value); }
+};
+
+/**
+ * @brief 字段编解码：枚举按底层整数类型转换
+ */
+template <typename T>
+struct FieldCodec<T, std::enable_if_t<std::is_enum_v<T>>> {
+    using Underlying = std::underlying_type_t<T>;
+
+    static NumberStatus decode(std::string_view text, T& value) {
+        Underlying raw{};
+        NumberStatus status = readNumber(text, raw);
+        if (status == NumberStatus::OK) {
+            value = static_cast<T>(raw);
+        }
+        return status;
+    }
+    static char* encode(char* first, const T& value) { return formatNumber(first, static_cast<Underlying>(value)); }
+};
+
+namespace detail {
+
+// 带种子的 FNV-1a，最后混合高位，使取低位作为槽位时分布均匀
+constexpr uint32_t hashTag(std::string_view tag, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (char c : tag) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
+// 槽位数：不小于字段数两倍的2的幂
+constexpr std::size_t slotCount(std::size_t fields) {
+    std::size_t slots = 1;
+    while (slots < fields * 2) {
+        slots <<= 1;
+    }
+    return slots;
+}
+
+/**
+ * @brief 编译期完美哈希：元素名 → 字段下标
+ */
+template <std::size_t N>
+struct TagIndex {
+    static constexpr std::size_t SLOTS = slotCount(N);
+
+    std::array<std::string_view, N> tags{};
+    uint32_t seed = 0;
+    std::array<int16_t, SLOTS> slots{};
+
+    /**
+     * @return 字段下标，不是表中的元素名时返回 -1
+     */
+    constexpr int find(std::string_view tag) const {
+        int index = slots[hashTag(tag, seed) & (SLOTS - 1)];
+        return index >= 0 && tags[index] == tag ? index : -1;
+    }
+};
+
+// 编译期搜索使所有元素名落在不同槽位的种子
+template <std::size_t N>
+constexpr TagIndex<N> buildTagIndex(const std::array<std::string_view, N>& tags) {
+    constexpr std::size_t SLOTS = TagIndex<N>::SLOTS;
+    for (uint32_t seed = 0; seed < 1000000; ++seed) {
+        TagIndex<N> index{};
+        index.tags = tags;
+        index.seed = seed;
+        for (auto& slot : index.slots) {
+            slot = -1;
+        }
+        bool collision = false;
+        for (std::size_t i = 0; i < N && !collision; ++i) {
+            auto& slot = index.slots[hashTag(tags[i], seed) & (SLOTS - 1)];
+            collision = slot >= 0;
+            slot = static_cast<int16_t>(i);
+        }
+        if (!collision) {
+            return index;
+        }
+    }
+    throw "找不到无冲突的哈希种子，字段表中是否有重复的元素名";
+}
+
+template <typename Table, std::size_t... I>
+constexpr std::array<std::string_view, sizeof...(I)> tagsOf(const Table& table, std::index_sequence<I...>) {
+    return {std::get<I>(table).tag...};
+}
+
+template <typename Owner>
+inline constexpr auto FIELDS = Owner::fieldTable();
+
+template <typename Owner>
+inline constexpr std::size_t FIELD_COUNT = std::tuple_size_v<std::remove_const_t<decltype(FIELDS<Owner>)>>;
+
+template <typename Owner>
+inline constexpr auto TAG_INDEX = buildTagIndex(tagsOf(FIELDS<Owner>, std::make_index_sequence<FIELD_COUNT<Owner>>()));
+
+template <typename Owner, std::size_t I>
+NumberStatus decodeField(Owner& owner, const XmlField& item) {
+    constexpr auto descriptor = std::get<I>(FIELDS<Owner>);
+    auto& value = owner.*(descriptor.member);
+    return FieldCodec<std::remove_reference_t<decltype(value)>>::decode(item.value, value);
+}
+
+template <typename Owner>
+using FieldDecoder = NumberStatus (*)(Owner&, const XmlField&);
+
+template <typename Owner, std::size_t... I>
+constexpr std::array<FieldDecoder<Owner>, sizeof...(I)> makeDecoders(std::index_sequence<I...>) {
+    return {&decodeField<Owner, I>...};
+}
+
+template <typename Owner>
+inline constexpr auto DECODERS = makeDecoders<Owner>(std::make_index_sequence<FIELD_COUNT<Owner>>());
+
+inline char* appendText(char* out, std::string_view text) {
+    std::memcpy(out, text.data(), text.size());
+    return out + text.size();
+}
+
+// 一行 <Tag>值</Tag> 先在栈上拼好再一次追加，逐段 append 每次都要检查容量
+template <typename Value>
+void encodeElement(std::string& out, std::string_view indent, std::string_view tag, const Value& value) {
+    char line[256];
+    if (indent.size() + 2 * tag.size() + 6 + MAX_NUMBER_CHARS > sizeof(line)) {
+        // 超长的元素名逐段追加
+        char number[MAX_NUMBER_CHARS];
+        out.append(indent).append(1, '<').append(tag).append(1, '>');
+        out.append(number, FieldCodec<Value>::encode(number, value) - number);
+        out.append("</").append(tag).append(">\n");
+        return;
+    }
+
+    char* end = appendText(line, indent);
+    *end++ = '<';
+    end = appendText(end, tag);
+    *end++ = '>';
+    end = FieldCodec<Value>::encode(end, value);
+    *end++ = '<';
+    *end++ = '/';
+    end = appendText(end, tag);
+    *end++ = '>';
+    *end++ = '\n';
+    out.append(line, end - line);
+}
+
+template <typename Owner, std::size_t... I>
+void encodeAll(const Owner& owner, std::string& out, std::string_view indent, std::index_sequence<I...>) {
+    auto encodeOne = [&](const auto& descriptor) {
+        const auto& value = owner.*(descriptor.member);
+        encodeElement(out, indent, descriptor.tag, value);
+    };
+    (encodeOne(std::get<I>(FIELDS<Owner>)), ...);
+}
+
+}  // namespace detail
+
+/**
+ * @brief 按字段表解析 Items 下的元素
+ *
+ * 只遍历一次元素，每个元素名经编译期完美哈希找到字段，表中没有的元素忽略。
+ * 元素缺失或为空时字段保持原值；文本不是有效数值时保留原值并计入返回的无效字段数，不记录日志。
+ *
+ * @param owner 写入的对象
+ * @param fields 消息体的扁平视图
+ * @return 无效（不是有效数值或超出范围）的字段数
+ */
+template <typename Owner>
+std::size_t decodeFields(Owner& owner, const PatrolFields& fields) {
+    std::size_t invalid = 0;
+    for (std::size_t i = 0; i < fields.itemCount; ++i) {
+        const XmlField& item = fields.items[i];
+        int index = detail::TAG_INDEX<Owner>.find(item.name);
+        if (index >= 0 && isInvalidNumber(detail::DECODERS<Owner>[index](owner, item))) {
+            ++invalid;
+        }
+    }
+    return invalid;
+}
+
+/**
+ * @brief 按字段表把 <Tag>值</Tag> 追加到缓冲区末尾，每个字段一行
+ * @param owner 读取的对象
+ * @param out 输出缓冲区，容量足够时不分配内存
+ * @param indent 每行的缩进
+ */
+template <typename Owner>
+void encodeFields(const Owner& owner, std::string& out, std::string_view indent = {}) {
+    detail::encodeAll(owner, out, indent, std::make_index_sequence<detail::FIELD_COUNT<Owner>>());
+}
+
+} // namespace protocol
@@ -0,0 +1,135 @@
+#include "frame_decoder.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// 环形缓冲区容量，必须为 2 的幂且不小于最大帧长度
+constexpr std::size_t RING_CAPACITY = 1u << 17;
+static_assert(RING_CAPACITY >= protocol::PROTOCOL_HEADER_SIZE + UINT16_MAX, "环形缓冲区必须能容纳最大帧");
+static_assert((RING_CAPACITY & (RING_CAPACITY - 1)) == 0, "环形缓冲区容量必须为2的幂");
+}  // namespace
+
+namespace protocol {
+
+FrameDecoder::FrameDecoder()
+    : buffer_(RING_CAPACITY), mask_(RING_CAPACITY - 1) {
+}
+
+char* FrameDecoder::prepare(std::size_t& size) {
+    std::size_t free_space = buffer_.size() - bufferedBytes();
+    std::size_t offset = tail_ & mask_;
+    size = std::min(free_space, buffer_.size() - offset);
+    return buffer_.data() + offset;
+}
+
+void FrameDecoder::commit(std::size_t size) {
+    tail_ += size;
+}
+
+void FrameDecoder::append(const char* data, std::size_t size) {
+    while (size > 0) {
+        std::size_t writable = 0;
+        char* dst = prepare(writable);
+        if (writable == 0) {
+            // 缓冲区已满且无法组成完整帧，只可能是损坏数据，丢弃最旧的字节
+            resync();
+            continue;
+        }
+        std::size_t n = std::min(writable, size);
+        std::memcpy(dst, data, n);
+        commit(n);
+        data += n;
+        size -= n;
+    }
+}
+
+bool FrameDecoder::nextFrame(FrameView& frame) {
+    while (true) {
+        std::size_t available = bufferedBytes();
+
+        // 校验已到达的同步字节
+        std::size_t sync_count = std::min(available, PROTOCOL_SYNC_BYTES.size());
+        bool synced = true;
+        for (std::size_t i = 0; i < sync_count; ++i) {
+            if (byteAt(i) != PROTOCOL_SYNC_BYTES[i]) {
+                synced = false;
+                break;
+            }
+        }
+        if (!synced) {
+            resync();
+            continue;
+        }
+
+        // 协议头尚未完整
+        if (available < PROTOCOL_HEADER_SIZE) {
+            return false;
+        }
+
+        copyOut(0, reinterpret_cast<char*>(&frame.header), PROTOCOL_HEADER_SIZE);
+        std::size_t body_size = frame.header.getBodySize();
+
+        // 消息体尚未完整
+        if (available < PROTOCOL_HEADER_SIZE + body_size) {
+            return false;
+        }
+
+        std::size_t body_offset = (head_ + PROTOCOL_HEADER_SIZE) & mask_;
+        if (body_offset + body_size <= buffer_.size()) {
+            frame.body = buffer_.data() + body_offset;
+        } else {
+            // 消息体跨越环绕点，线性化到临时缓冲区
+            scratch_.resize(body_size);
+            copyOut(PROTOCOL_HEADER_SIZE, scratch_.data(), body_size);
+            frame.body = scratch_.data();
+        }
+        frame.size = body_size;
+
+        head_ += PROTOCOL_HEADER_SIZE + body_size;
+        return true;
+    }
+}
+
+void FrameDecoder::reset() {
+    head_ = 0;
+    tail_ = 0;
+    discarded_bytes_ = 0;
+}
+
+void FrameDecoder::copyOut(std::size_t offset, char* dst, std::size_t size) const {
+    std::size_t start = (head_ + offset) & mask_;
+    std::size_t first = std::min(size, buffer_.size() - start);
+    std::memcpy(dst, buffer_.data() + start, first);
+    std::memcpy(dst + first, buffer_.data(), size - first);
+}
+
+uint8_t FrameDecoder::byteAt(std::size_t offset) const {
+    return static_cast<uint8_t>(buffer_[(head_ + offset) & mask_]);
+}
+
+void FrameDecoder::resync() {
+    // 至少丢弃当前字节，然后扫描到下一个可能的同步序列起点
+    do {
+        ++head_;
+        ++discarded_bytes_;
+        if (head_ == tail_) {
+            return;
+        }
+        if (byteAt(0) != PROTOCOL_SYNC_BYTES[0]) {
+            continue;
+        }
+        std::size_t count = std::min(bufferedBytes(), PROTOCOL_SYNC_BYTES.size());
+        bool matched = true;
+        for (std::size_t i = 1; i < count; ++i) {
+            if (byteAt(i) != PROTOCOL_SYNC_BYTES[i]) {
+                matched = false;
+                break;
+            }
+        }
+        if (matched) {
+            return;
+        }
+    } while (true);
+}
+
+} // namespace protocol
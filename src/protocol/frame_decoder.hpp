@@ -0,0 +1,106 @@
+#pragma once
+
+#include "protocol_header.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace protocol {
+
+/**
+ * @brief 帧视图，指向解码器内部缓冲区
+ *
+ * body 在下一次调用 FrameDecoder::nextFrame / prepare / commit 之前有效。
+ */
+struct FrameView {
+    ProtocolHeader header;        ///< 协议头（已拷贝）
+    const char* body = nullptr;   ///< 消息体起始地址
+    std::size_t size = 0;         ///< 消息体长度
+};
+
+/**
+ * @brief 流式帧解码器
+ *
+ * 基于环形缓冲区的增量解码：socket 直接读入 prepare() 返回的空间，
+ * 每次 commit() 后循环调用 nextFrame() 取出所有完整帧。
+ * 先校验协议头再按长度等待消息体，遇到损坏数据时向前扫描
+ * 下一个 0xEB 0x90 0xEB 0x90 同步序列，每个字节最多被检查常数次。
+ */
+class FrameDecoder {
+public:
+    /**
+     * @brief 构造函数
+     *
+     * 容量为 2 的幂且不小于最大帧长度（16 + 65535），保证任意完整帧都能放入缓冲区。
+     */
+    FrameDecoder();
+
+    /**
+     * @brief 获取可写入的连续空间
+     * @param size 输出参数，可写入的字节数
+     * @return 可写入空间的起始地址
+     */
+    char* prepare(std::size_t& size);
+
+    /**
+     * @brief 提交已写入 prepare() 空间的字节
+     * @param size 写入的字节数
+     */
+    void commit(std::size_t size);
+
+    /**
+     * @brief 追加一段数据（会拷贝，供非 socket 直读场景使用）
+     * @param data 数据地址
+     * @param size 数据长度
+     */
+    void append(const char* data, std::size_t size);
+
+    /**
+     * @brief 取出下一个完整帧
+     * @param frame 输出参数，帧视图
+     * @return 是否取出了完整帧；返回false表示需要更多数据
+     */
+    bool nextFrame(FrameView& frame);
+
+    /**
+     * @brief 清空缓冲区和统计信息（重连时使用）
+     */
+    void reset();
+
+    /**
+     * @brief 获取缓冲区中尚未解码的字节数
+     * @return 字节数
+     */
+    std::size_t bufferedBytes() const { return tail_ - head_; }
+
+    /**
+     * @brief 获取因同步字节错误而丢弃的累计字节数
+     * @return 丢弃的字节数
+     */
+    uint64_t discardedBytes() const { return discarded_bytes_; }
+
+private:
+    /**
+     * @brief 拷贝从 head_ 偏移 offset 处开始的 size 个字节（处理环绕）
+     */
+    void copyOut(std::size_t offset, char* dst, std::size_t size) const;
+
+    /**
+     * @brief 读取从 head_ 偏移 offset 处的字节
+     */
+    uint8_t byteAt(std::size_t offset) const;
+
+    /**
+     * @brief 丢弃数据直到下一个可能的同步序列
+     */
+    void resync();
+
+    std::vector<char> buffer_;     // 环形缓冲区
+    std::size_t mask_;             // 容量掩码
+    std::size_t head_ = 0;         // 读位置（单调递增，取模使用）
+    std::size_t tail_ = 0;         // 写位置（单调递增，取模使用）
+    std::vector<char> scratch_;    // 跨越环绕点的帧体线性化缓冲区
+    uint64_t discarded_bytes_ = 0; // 丢弃的字节数
+};
+
+} // namespace protocol
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "patrol_fields.hpp"
 #include <string>
 #include <memory>
 
@@ -65,11 +66,24 @@ public:
      */
     virtual MessageType getType() const = 0;
 
+    /**
+     * @brief 把消息体追加到缓冲区末尾
+     *
+     * 发送路径传入复用的缓冲区，容量足够时序列化不分配内存。
+     *
+     * @param out 输出缓冲区，不会被清空
+     */
+    virtual void serializeTo(std::string& out) const = 0;
+
     /**
      * @brief 序列化消息为字符串
      * @return 序列化后的字符串
      */
-    virtual std::string serialize() const = 0;
+    std::string serialize() const {
+        std::string out;
+        serializeTo(out);
+        return out;
+    }
 
     /**
      * @brief 从字符串反序列化消息
@@ -78,6 +92,19 @@ public:
      */
     virtual bool deserialize(const std::string& data) = 0;
 
+    /**
+     * @brief 从已解析的消息体反序列化消息，接收路径用它避免重复解析消息体
+     * @param fields 消息体的扁平视图
+     * @return 是否成功，不支持反序列化的消息（请求）返回 false
+     */
+    virtual bool deserializeFields(const PatrolFields& fields) { (void)fields; return false; }
+
+    /**
+     * @brief 获取反序列化时无效的数值字段数
+     * @return 文本不是有效数值或超出范围、因而保留默认值的字段数
+     */
+    virtual std::size_t getInvalidFieldCount() const { return 0; }
+
     /**
      * @brief 获取消息序列号
      * @return 消息序列号
@@ -89,6 +116,12 @@ public:
      * @param sequenceNumber 消息序列号
      */
     virtual void setSequenceNumber(uint16_t sequenceNumber) = 0;
+
+    /**
+     * @brief 获取命令码（Command字段），发送队列据此区分同类型的不同命令
+     * @return 命令码，没有命令码的消息返回0
+     */
+    virtual int getCommand() const { return 0; }
 };
 
 /**
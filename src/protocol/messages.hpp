@@ -1,13 +1,12 @@
 #pragma once
 
 #include "message_interface.hpp"
+#include "field_table.hpp"
 #include <vector>
 #include <string>
+#include <string_view>
 #include <chrono>
 #include <nlohmann/json.hpp>
-#include <rapidxml/rapidxml.hpp>
-#include <sstream>
-#include <iomanip>
 #include <ctime>
 #include <variant>
 
@@ -31,23 +30,57 @@ struct NavigationPoint {
     int navMode = 0;
     int terrain = 0;
     int posture = 0;
+
+    /**
+     * @brief 字段描述表：XML元素名 → 成员
+     */
+    static constexpr auto fieldTable() {
+        using Self = NavigationPoint;
+        return std::make_tuple(
+            field("MapId", &Self::mapId), field("Value", &Self::value), field("PosX", &Self::posX),
+            field("PosY", &Self::posY), field("PosZ", &Self::posZ), field("AngleYaw", &Self::angleYaw),
+            field("PointInfo", &Self::pointInfo), field("Gait", &Self::gait), field("Speed", &Self::speed),
+            field("Manner", &Self::manner), field("ObsMode", &Self::obsMode), field("NavMode", &Self::navMode),
+            field("Terrain", &Self::terrain), field("Posture", &Self::posture));
+    }
 };
 
+/**
+ * @brief 当前时间戳 "YYYY-MM-DD HH:MM:SS"（本地时间）
+ *
+ * 按线程缓存格式化结果，同一秒内直接返回缓存，跨秒时用 strftime 写入定长缓冲区，不分配内存。
+ *
+ * @return 指向本线程缓存的时间戳，在本线程下一次调用之前有效
+ */
+std::string_view currentTimestamp();
+
 /**
  * @brief 获取当前时间戳字符串
  * @return 格式化的时间戳字符串
  */
 inline std::string getCurrentTimestamp() {
-    auto now = std::chrono::system_clock::now();
-    auto time_t_now = std::chrono::system_clock::to_time_t(now);
-    std::stringstream ss;
-    ss << std::put_time(std::localtime(&time_t_now), "%Y-%m-%d %H:%M:%S");
-    return ss.str();
+    return std::string(currentTimestamp());
+}
+
+/**
+ * @brief 追加 PatrolDevice 消息体的开头：XML声明、Type、Command、Time
+ * @param out 输出缓冲区
+ * @param type 消息类型编号
+ * @param command 命令编号
+ * @param timestamp 时间戳字符串，为空时使用当前时间
+ */
+inline void appendPatrolDeviceHeader(std::string& out, int type, int command, const std::string& timestamp) {
+    out.append("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<PatrolDevice>\n<Type>");
+    appendNumber(out, type);
+    out.append("</Type>\n<Command>");
+    appendNumber(out, command);
+    out.append("</Command>\n<Time>").append(timestamp.empty() ? currentTimestamp() : timestamp).append("</Time>\n");
 }
 
 class MessageBase : public IMessage {
 public:
     uint16_t sequenceNumber = 0;
+    std::size_t invalidFieldCount = 0; ///< 反序列化时无效的数值字段数
 
     uint16_t getSequenceNumber() const override {
         return sequenceNumber;
@@ -56,6 +89,15 @@ public:
     void setSequenceNumber(uint16_t sequenceNumber) override {
         this->sequenceNumber = sequenceNumber;
     }
+
+    std::size_t getInvalidFieldCount() const override {
+        return invalidFieldCount;
+    }
+
+    /**
+     * @brief 解析消息体后交给 deserializeFields()，供单独持有消息体字符串的调用方使用
+     */
+    bool deserialize(const std::string& data) override;
 };
 
 /**
@@ -63,29 +105,17 @@ public:
  */
 class GetRealTimeStatusRequest : public MessageBase {
 public:
-    std::string timestamp;
+    std::string timestamp; ///< 时间戳，为空时序列化时使用当前时间
 
-    GetRealTimeStatusRequest() : timestamp(getCurrentTimestamp()) {}
 
     MessageType getType() const override {
         return MessageType::GET_REAL_TIME_STATUS_REQ;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // 使用XML格式
-        std::stringstream ss;
-        ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-        ss << "<PatrolDevice>\n";
-        ss << "<Type>1002</Type>\n";
-        ss << "<Command>1</Command>\n";
-        ss << "<Time>" << timestamp << "</Time>\n";
-        ss << "<Items/>\n";
-        ss << "</PatrolDevice>";
-        return ss.str();
-    }
-
-    bool deserialize(const std::string&) override {
-        return false;
+        appendPatrolDeviceHeader(out, 1002, 1, timestamp);
+        out.append("<Items/>\n</PatrolDevice>");
     }
 };
 
@@ -127,64 +157,33 @@ public:
         return MessageType::GET_REAL_TIME_STATUS_RESP;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // sdk不负责响应的序列化
-        return "";
-    }
-
-    bool deserialize(const std::string& data) override {
-        try {
-            rapidxml::xml_document<> doc;
-            std::vector<char> buffer(data.begin(), data.end());
-            buffer.push_back('\0');
-            doc.parse<rapidxml::parse_non_destructive>(&buffer[0]);
-
-            rapidxml::xml_node<>* root = doc.first_node("PatrolDevice");
-            if (!root) return false;
-
-            rapidxml::xml_node<>* items_node = root->first_node("Items");
-            if (!items_node) return false;
-
-            // 解析各个字段
-            auto get_node_value = [&](const char* name, auto& value) {
-                rapidxml::xml_node<>* node = items_node->first_node(name);
-                if (node) {
-                    std::stringstream ss(node->value());
-                    ss >> value;
-                }
-            };
-
-            get_node_value("MotionState", motionState);
-            get_node_value("PosX", posX);
-            get_node_value("PosY", posY);
-            get_node_value("PosZ", posZ);
-            get_node_value("AngleYaw", angleYaw);
-            get_node_value("Roll", roll);
-            get_node_value("Pitch", pitch);
-            get_node_value("Yaw", yaw);
-            get_node_value("Speed", speed);
-            get_node_value("CurOdom", curOdom);
-            get_node_value("SumOdom", sumOdom);
-            get_node_value("CurRuntime", curRuntime);
-            get_node_value("SumRuntime", sumRuntime);
-            get_node_value("Res", res);
-            get_node_value("X0", x0);
-            get_node_value("Y0", y0);
-            get_node_value("H", h);
-            get_node_value("Electricity", electricity);
-            get_node_value("Location", location);
-            get_node_value("RTKState", RTKState);
-            get_node_value("OnDockState", onDockState);
-            get_node_value("GaitState", gaitState);
-            get_node_value("MotorState", motorState);
-            get_node_value("ChargeState", chargeState);
-            get_node_value("ControlMode", controlMode);
-            get_node_value("MapUpdateState", mapUpdateState);
-
-            return true;
-        } catch (const std::exception& e) {
-            return false;
-        }
+        (void)out;
+    }
+
+    /**
+     * @brief 字段描述表：XML元素名 → 成员
+     */
+    static constexpr auto fieldTable() {
+        using Self = GetRealTimeStatusResponse;
+        return std::make_tuple(
+            field("MotionState", &Self::motionState), field("PosX", &Self::posX), field("PosY", &Self::posY),
+            field("PosZ", &Self::posZ), field("AngleYaw", &Self::angleYaw), field("Roll", &Self::roll),
+            field("Pitch", &Self::pitch), field("Yaw", &Self::yaw), field("Speed", &Self::speed),
+            field("CurOdom", &Self::curOdom), field("SumOdom", &Self::sumOdom), field("CurRuntime", &Self::curRuntime),
+            field("SumRuntime", &Self::sumRuntime), field("Res", &Self::res), field("X0", &Self::x0),
+            field("Y0", &Self::y0), field("H", &Self::h), field("Electricity", &Self::electricity),
+            field("Location", &Self::location), field("RTKState", &Self::RTKState),
+            field("OnDockState", &Self::onDockState), field("GaitState", &Self::gaitState),
+            field("MotorState", &Self::motorState), field("ChargeState", &Self::chargeState),
+            field("ControlMode", &Self::controlMode), field("MapUpdateState", &Self::mapUpdateState));
+    }
+
+    bool deserializeFields(const PatrolFields& fields) override {
+        if (!fields.hasItems) return false;
+        invalidFieldCount = decodeFields(*this, fields);
+        return true;
     }
 };
 
@@ -194,49 +193,25 @@ public:
 class NavigationTaskRequest : public MessageBase {
 public:
     std::vector<NavigationPoint> points;
-    std::string timestamp;
+    std::string timestamp; ///< 时间戳，为空时序列化时使用当前时间
 
-    NavigationTaskRequest() : timestamp(getCurrentTimestamp()) {}
 
     MessageType getType() const override {
         return MessageType::NAVIGATION_TASK_REQ;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // 使用XML格式
-        std::stringstream ss;
-        ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-        ss << "<PatrolDevice>\n";
-        ss << "<Type>1003</Type>\n";
-        ss << "<Command>1</Command>\n";
-        ss << "<Time>" << timestamp << "</Time>\n";
+        appendPatrolDeviceHeader(out, 1003, 1, timestamp);
 
         // 添加导航点
         for (const auto& point : points) {
-            ss << "<Items>\n";
-            ss << "  <MapId>" << point.mapId << "</MapId>\n";
-            ss << "  <Value>" << point.value << "</Value>\n";
-            ss << "  <PosX>" << point.posX << "</PosX>\n";
-            ss << "  <PosY>" << point.posY << "</PosY>\n";
-            ss << "  <PosZ>" << point.posZ << "</PosZ>\n";
-            ss << "  <AngleYaw>" << point.angleYaw << "</AngleYaw>\n";
-            ss << "  <PointInfo>" << point.pointInfo << "</PointInfo>\n";
-            ss << "  <Gait>" << point.gait << "</Gait>\n";
-            ss << "  <Speed>" << point.speed << "</Speed>\n";
-            ss << "  <Manner>" << point.manner << "</Manner>\n";
-            ss << "  <ObsMode>" << point.obsMode << "</ObsMode>\n";
-            ss << "  <NavMode>" << point.navMode << "</NavMode>\n";
-            ss << "  <Terrain>" << point.terrain << "</Terrain>\n";
-            ss << "  <Posture>" << point.posture << "</Posture>\n";
-            ss << "</Items>\n";
+            out.append("<Items>\n");
+            encodeFields(point, out, "  ");
+            out.append("</Items>\n");
         }
 
-        ss << "</PatrolDevice>";
-        return ss.str();
-    }
-
-    bool deserialize(const std::string&) override {
-        return false;
+        out.append("</PatrolDevice>");
     }
 };
 
@@ -255,46 +230,24 @@ public:
         return MessageType::NAVIGATION_TASK_RESP;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // sdk不负责响应的序列化
-        return "";
+        (void)out;
     }
 
-    bool deserialize(const std::string& data) override {
-        try {
-            rapidxml::xml_document<> doc;
-            std::vector<char> buffer(data.begin(), data.end());
-            buffer.push_back('\0');
-            doc.parse<rapidxml::parse_non_destructive>(&buffer[0]);
-
-            rapidxml::xml_node<>* root = doc.first_node("PatrolDevice");
-            if (!root) return false;
-
-            rapidxml::xml_node<>* items_node = root->first_node("Items");
-            if (!items_node) return false;
-
-            // 解析各个字段
-            auto get_node_value = [&](const char* name, auto& value) {
-                rapidxml::xml_node<>* node = items_node->first_node(name);
-                if (node) {
-                    std::stringstream ss(node->value());
-                    ss >> value;
-                }
-            };
-
-            get_node_value("Value", value);
-
-            // 解析错误码
-            int error_code_value = 0;
-            get_node_value("ErrorCode", error_code_value);
-            errorCode = static_cast<ErrorCode_Navigation>(error_code_value);
-
-            get_node_value("ErrorStatus", errorStatus);
+    /**
+     * @brief 字段描述表：XML元素名 → 成员
+     */
+    static constexpr auto fieldTable() {
+        using Self = NavigationTaskResponse;
+        return std::make_tuple(
+            field("Value", &Self::value), field("ErrorCode", &Self::errorCode), field("ErrorStatus", &Self::errorStatus));
+    }
 
-            return true;
-        } catch (const std::exception& e) {
-            return false;
-        }
+    bool deserializeFields(const PatrolFields& fields) override {
+        if (!fields.hasItems) return false;
+        invalidFieldCount = decodeFields(*this, fields);
+        return true;
     }
 };
 
@@ -303,29 +256,17 @@ public:
  */
 class QueryStatusRequest : public MessageBase {
 public:
-    std::string timestamp;
+    std::string timestamp; ///< 时间戳，为空时序列化时使用当前时间
 
-    QueryStatusRequest() : timestamp(getCurrentTimestamp()) {}
 
     MessageType getType() const override {
         return MessageType::QUERY_STATUS_REQ;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // 使用XML格式
-        std::stringstream ss;
-        ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-        ss << "<PatrolDevice>\n";
-        ss << "<Type>1007</Type>\n";
-        ss << "<Command>1</Command>\n";
-        ss << "<Time>" << timestamp << "</Time>\n";
-        ss << "<Items/>\n";
-        ss << "</PatrolDevice>";
-        return ss.str();
-    }
-
-    bool deserialize(const std::string&) override {
-        return false;
+        appendPatrolDeviceHeader(out, 1007, 1, timestamp);
+        out.append("<Items/>\n</PatrolDevice>");
     }
 };
 
@@ -344,47 +285,24 @@ public:
         return MessageType::QUERY_STATUS_RESP;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // sdk不负责响应的序列化
-        return "";
+        (void)out;
     }
 
-    bool deserialize(const std::string& data) override {
-        try {
-            rapidxml::xml_document<> doc;
-            std::vector<char> buffer(data.begin(), data.end());
-            buffer.push_back('\0');
-            doc.parse<rapidxml::parse_non_destructive>(&buffer[0]);
-
-            rapidxml::xml_node<>* root = doc.first_node("PatrolDevice");
-            if (!root) return false;
-
-            rapidxml::xml_node<>* items_node = root->first_node("Items");
-            if (!items_node) return false;
-
-            // 解析各个字段
-            auto get_node_value = [&](const char* name, auto& value) {
-                rapidxml::xml_node<>* node = items_node->first_node(name);
-                if (node) {
-                    std::stringstream ss(node->value());
-                    ss >> value;
-                }
-            };
-
-            get_node_value("Value", value);
-
-            // 解析状态
-            get_node_value("Status", status);
-
-            // 解析错误码
-            int error_code_value = 0;
-            get_node_value("ErrorCode", error_code_value);
-            errorCode = static_cast<ErrorCode_QueryStatus>(error_code_value);
+    /**
+     * @brief 字段描述表：XML元素名 → 成员
+     */
+    static constexpr auto fieldTable() {
+        using Self = QueryStatusResponse;
+        return std::make_tuple(
+            field("Value", &Self::value), field("Status", &Self::status), field("ErrorCode", &Self::errorCode));
+    }
 
-            return true;
-        } catch (const std::exception& e) {
-            return false;
-        }
+    bool deserializeFields(const PatrolFields& fields) override {
+        if (!fields.hasItems) return false;
+        invalidFieldCount = decodeFields(*this, fields);
+        return true;
     }
 };
 
@@ -393,29 +311,17 @@ public:
  */
 class CancelTaskRequest : public MessageBase {
 public:
-    std::string timestamp;
+    std::string timestamp; ///< 时间戳，为空时序列化时使用当前时间
 
-    CancelTaskRequest() : timestamp(getCurrentTimestamp()) {}
 
     MessageType getType() const override {
         return MessageType::CANCEL_TASK_REQ;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // 使用XML格式
-        std::stringstream ss;
-        ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-        ss << "<PatrolDevice>\n";
-        ss << "<Type>1004</Type>\n";
-        ss << "<Command>1</Command>\n";
-        ss << "<Time>" << timestamp << "</Time>\n";
-        ss << "<Items/>\n";
-        ss << "</PatrolDevice>";
-        return ss.str();
-    }
-
-    bool deserialize(const std::string&) override {
-        return false;
+        appendPatrolDeviceHeader(out, 1004, 1, timestamp);
+        out.append("<Items/>\n</PatrolDevice>");
     }
 };
 
@@ -432,37 +338,24 @@ public:
         return MessageType::CANCEL_TASK_RESP;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // sdk不负责响应的序列化
-        return "";
-    }
-
-    bool deserialize(const std::string& data) override {
-        try {
-            rapidxml::xml_document<> doc;
-            std::vector<char> buffer(data.begin(), data.end());
-            buffer.push_back('\0');
-            doc.parse<rapidxml::parse_non_destructive>(&buffer[0]);
-
-            rapidxml::xml_node<>* root = doc.first_node("PatrolDevice");
-            if (!root) return false;
-
-            rapidxml::xml_node<>* items_node = root->first_node("Items");
-            if (!items_node) return false;
-
-            // 解析错误码
-            int error_code_value = 0;
-            rapidxml::xml_node<>* error_code_node = items_node->first_node("ErrorCode");
-            if (error_code_node) {
-                std::stringstream ss(error_code_node->value());
-                ss >> error_code_value;
-                errorCode = static_cast<ErrorCode_CancelTask>(error_code_value);
-            }
-
-            return true;
-        } catch (const std::exception& e) {
-            return false;
-        }
+        (void)out;
+    }
+
+    /**
+     * @brief 字段描述表：XML元素名 → 成员
+     */
+    static constexpr auto fieldTable() {
+        using Self = CancelTaskResponse;
+        return std::make_tuple(
+            field("ErrorCode", &Self::errorCode));
+    }
+
+    bool deserializeFields(const PatrolFields& fields) override {
+        if (!fields.hasItems) return false;
+        invalidFieldCount = decodeFields(*this, fields);
+        return true;
     }
 };
 
@@ -471,29 +364,17 @@ public:
  */
 class RTKFusionDataRequest : public MessageBase {
 public:
-    std::string timestamp;
+    std::string timestamp; ///< 时间戳，为空时序列化时使用当前时间
 
-    RTKFusionDataRequest() : timestamp(getCurrentTimestamp()) {}
 
     MessageType getType() const override {
         return MessageType::RTK_FUSION_DATA_REQ;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // 使用XML格式
-        std::stringstream ss;
-        ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-        ss << "<PatrolDevice>\n";
-        ss << "<Type>2102</Type>\n";
-        ss << "<Command>1</Command>\n";
-        ss << "<Time>" << timestamp << "</Time>\n";
-        ss << "<Items/>\n";
-        ss << "</PatrolDevice>";
-        return ss.str();
-    }
-
-    bool deserialize(const std::string&) override {
-        return false;
+        appendPatrolDeviceHeader(out, 2102, 1, timestamp);
+        out.append("<Items/>\n</PatrolDevice>");
     }
 };
 
@@ -513,12 +394,22 @@ public:
         return MessageType::RTK_FUSION_DATA_RESP;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // sdk不负责响应的序列化
-        return "";
+        (void)out;
     }
 
-    bool deserialize(const std::string& data) override;
+    /**
+     * @brief 字段描述表：XML元素名 → 成员
+     */
+    static constexpr auto fieldTable() {
+        using Self = RTKFusionDataResponse;
+        return std::make_tuple(
+            field("Longitude", &Self::longitude), field("Latitude", &Self::latitude),
+            field("ElpHeight", &Self::elpHeight), field("Yaw", &Self::yaw));
+    }
+
+    bool deserializeFields(const PatrolFields& fields) override;
 };
 
 /**
@@ -526,29 +417,17 @@ public:
  */
 class RTKRawDataRequest : public MessageBase {
 public:
-    std::string timestamp;
+    std::string timestamp; ///< 时间戳，为空时序列化时使用当前时间
 
-    RTKRawDataRequest() : timestamp(getCurrentTimestamp()) {}
 
     MessageType getType() const override {
         return MessageType::RTK_RAW_DATA_REQ;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // 使用XML格式
-        std::stringstream ss;
-        ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-        ss << "<PatrolDevice>\n";
-        ss << "<Type>2103</Type>\n";
-        ss << "<Command>1</Command>\n";
-        ss << "<Time>" << timestamp << "</Time>\n";
-        ss << "<Items/>\n";
-        ss << "</PatrolDevice>";
-        return ss.str();
-    }
-
-    bool deserialize(const std::string&) override {
-        return false;
+        appendPatrolDeviceHeader(out, 2103, 1, timestamp);
+        out.append("<Items/>\n</PatrolDevice>");
     }
 };
 
@@ -568,12 +447,22 @@ public:
         return MessageType::RTK_RAW_DATA_RESP;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // sdk不负责响应的序列化
-        return "";
+        (void)out;
     }
 
-    bool deserialize(const std::string& data) override;
+    /**
+     * @brief 字段描述表：XML元素名 → 成员
+     */
+    static constexpr auto fieldTable() {
+        using Self = RTKRawDataResponse;
+        return std::make_tuple(
+            field("Longitude", &Self::longitude), field("Latitude", &Self::latitude),
+            field("ElpHeight", &Self::elpHeight), field("Yaw", &Self::yaw));
+    }
+
+    bool deserializeFields(const PatrolFields& fields) override;
 };
 
 /**
@@ -583,9 +472,8 @@ class MotionControlRequest : public MessageBase {
 public:
     int command = 1;
     std::variant<float, int> value = -1.0f;
-    std::string timestamp;
+    std::string timestamp; ///< 时间戳，为空时序列化时使用当前时间
 
-    MotionControlRequest() : timestamp(getCurrentTimestamp()) {}
 
     // // 设置浮点值
     // void setValue(float val) {
@@ -606,32 +494,26 @@ public:
         return MessageType::MOTION_CONTROL_REQ;
     }
 
-    std::string serialize() const override {
+    int getCommand() const override {
+        return command;
+    }
+
+    void serializeTo(std::string& out) const override {
         // 使用XML格式
-        std::stringstream ss;
-        ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-        ss << "<PatrolDevice>\n";
-        ss << "<Type>2</Type>\n";
-        ss << "<Command>" << command << "</Command>\n";
-        ss << "<Time>" << timestamp << "</Time>\n";
-        ss << "<Items>\n";
+        appendPatrolDeviceHeader(out, 2, command, timestamp);
+        out.append("<Items>\n");
 
         // 根据值的类型序列化
-        ss << "  <Value>";
+        out.append("  <Value>");
         if (std::holds_alternative<float>(value)) {
-            ss << std::get<float>(value);
+            appendNumber(out, std::get<float>(value));
         } else {
-            ss << std::get<int>(value);
+            appendNumber(out, std::get<int>(value));
         }
-        ss << "</Value>\n";
-
-        ss << "</Items>\n";
-        ss << "</PatrolDevice>";
-        return ss.str();
-    }
+        out.append("</Value>\n");
 
-    bool deserialize(const std::string&) override {
-        return false;
+        out.append("</Items>\n");
+        out.append("</PatrolDevice>");
     }
 };
 
@@ -649,12 +531,21 @@ public:
         return MessageType::MOTION_CONTROL_RESP;
     }
 
-    std::string serialize() const override {
+    void serializeTo(std::string& out) const override {
         // sdk不负责响应的序列化
-        return "";
+        (void)out;
     }
 
-    bool deserialize(const std::string& data) override;
+    /**
+     * @brief 字段描述表：XML元素名 → 成员
+     */
+    static constexpr auto fieldTable() {
+        using Self = MotionControlResponse;
+        return std::make_tuple(
+            field("ErrorCode", &Self::errorCode));
+    }
+
+    bool deserializeFields(const PatrolFields& fields) override;
 
     // 获取浮点值
     float getFloatValue() const {
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace protocol {
+
+/**
+ * @brief 消息体中的一个简单元素 <Name>值</Name>
+ */
+struct XmlField {
+    std::string_view name;   ///< 元素名
+    std::string_view value;  ///< 元素文本，<Name/> 为空
+};
+
+/**
+ * @brief 数值字段的解析结果
+ */
+enum class NumberStatus {
+    OK = 0,        ///< 成功
+    EMPTY,         ///< 文本为空（如 <H/>）
+    INVALID,       ///< 不是完整的数值（含多余字符、负数写入无符号字段等）
+    OUT_OF_RANGE   ///< 超出字段类型的范围
+};
+
+/**
+ * @brief 从字符串解析数值，用于消息字段
+ *
+ * 整个文本（去掉首尾空白后）必须是一个数值，不接受 "1.5abc" 这类部分匹配。
+ * 使用 std::from_chars，不受 locale 影响、不分配内存；标准库不支持浮点 from_chars 时退回 strtod。
+ *
+ * @param text 字段文本（不要求以0结尾）
+ * @param value 解析结果，失败时不修改
+ * @return 解析结果
+ */
+template <typename T>
+NumberStatus readNumber(std::string_view text, T& value) {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "readNumber only supports numbers");
+
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+        text.remove_suffix(1);
+    }
+    // from_chars 不接受前导 '+'
+    if (text.size() > 1 && text.front() == '+' && text[1] != '-') {
+        text.remove_prefix(1);
+    }
+    if (text.empty()) {
+        return NumberStatus::EMPTY;
+    }
+
+    const char* first = text.data();
+    const char* last = first + text.size();
+    T parsed{};
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    std::from_chars_result result = std::from_chars(first, last, parsed);
+#else
+    std::from_chars_result result{first, std::errc::invalid_argument};
+    if constexpr (std::is_floating_point_v<T>) {
+        // 字段值很短，拷贝到栈上补0后交给 strtod
+        char buffer[64];
+        if (text.size() >= sizeof(buffer)) {
+            return NumberStatus::INVALID;
+        }
+        std::memcpy(buffer, first, text.size());
+        buffer[text.size()] = '\0';
+        char* end = buffer;
+        errno = 0;
+        long double number = std::strtold(buffer, &end);
+        bool overflow = errno == ERANGE || number > std::numeric_limits<T>::max() || number < std::numeric_limits<T>::lowest();
+        parsed = static_cast<T>(number);
+        result = {first + (end - buffer), end == buffer ? std::errc::invalid_argument
+                                          : overflow     ? std::errc::result_out_of_range
+                                                         : std::errc()};
+    } else {
+        result = std::from_chars(first, last, parsed);
+    }
+#endif
+    if (result.ec == std::errc::result_out_of_range) {
+        return NumberStatus::OUT_OF_RANGE;
+    }
+    if (result.ec != std::errc() || result.ptr != last) {
+        return NumberStatus::INVALID;
+    }
+    value = parsed;
+    return NumberStatus::OK;
+}
+
+/// formatNumber() 输出的最大字符数
+constexpr std::size_t MAX_NUMBER_CHARS = 32;
+
+/**
+ * @brief 把数值格式化到字符数组，用于消息字段
+ *
+ * 使用 std::to_chars：不受 locale 影响、不分配内存，浮点数输出能精确还原的最短形式。
+ * 标准库不支持浮点 to_chars 时退回 snprintf（max_digits10 位有效数字）。
+ *
+ * @param first 输出位置，至少有 MAX_NUMBER_CHARS 个字符的空间
+ * @param value 数值
+ * @return 输出的末尾
+ */
+template <typename T>
+char* formatNumber(char* first, T value) {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "formatNumber only supports numbers");
+
+    char* last = first + MAX_NUMBER_CHARS;
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    return std::to_chars(first, last, value).ptr;
+#else
+    if constexpr (std::is_floating_point_v<T>) {
+        int length = std::snprintf(first, MAX_NUMBER_CHARS, "%.*g", std::numeric_limits<T>::max_digits10,
+                                   static_cast<double>(value));
+        return first + (length > 0 ? std::min<std::size_t>(length, MAX_NUMBER_CHARS - 1) : 0);
+    } else {
+        return std::to_chars(first, last, value).ptr;
+    }
+#endif
+}
+
+/**
+ * @brief 把数值追加到缓冲区末尾，容量足够时不分配内存
+ * @param out 输出缓冲区
+ * @param value 数值
+ */
+template <typename T>
+void appendNumber(std::string& out, T value) {
+    char buffer[MAX_NUMBER_CHARS];
+    out.append(buffer, formatNumber(buffer, value) - buffer);
+}
+
+/**
+ * @brief 数值字段是否无效（文本存在但不是有效数值或超出范围），空文本不算无效
+ */
+inline bool isInvalidNumber(NumberStatus status) {
+    return status == NumberStatus::INVALID || status == NumberStatus::OUT_OF_RANGE;
+}
+
+/**
+ * @brief PatrolDevice 消息体的扁平视图
+ *
+ * 所有响应的消息体都是 <PatrolDevice><Type/><Command/><Time/><Items>...</Items></PatrolDevice>，
+ * Items 下是一层简单元素。视图中的字符串指向消息体（或XML文档的缓冲区），不拷贝、不分配内存，
+ * 在消息体释放或下一次解析之前有效。
+ */
+struct PatrolFields {
+    static constexpr std::size_t MAX_ITEMS = 64;  ///< Items 下最多的元素数
+
+    std::string_view type;     ///< <Type> 的文本
+    std::string_view command;  ///< <Command> 的文本
+    std::string_view time;     ///< <Time> 的文本
+    bool hasItems = false;     ///< 是否有 <Items> 元素
+    std::array<XmlField, MAX_ITEMS> items{};  ///< Items 下的元素，按出现顺序
+    std::size_t itemCount = 0;                ///< items 中的有效元素数
+
+    /**
+     * @brief 清空视图
+     */
+    void clear() {
+        type = command = time = std::string_view();
+        hasItems = false;
+        itemCount = 0;
+    }
+
+    /**
+     * @brief 追加一个 Items 下的元素
+     * @return 元素数已满时返回 false
+     */
+    bool addItem(std::string_view name, std::string_view value) {
+        if (itemCount == MAX_ITEMS) {
+            return false;
+        }
+        items[itemCount++] = XmlField{name, value};
+        return true;
+    }
+
+    /**
+     * @brief 查找 Items 下的元素
+     * @param name 元素名
+     * @return 元素，不存在时返回 nullptr
+     */
+    const XmlField* findItem(std::string_view name) const {
+        for (std::size_t i = 0; i < itemCount; ++i) {
+            if (items[i].name == name) {
+                return &items[i];
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief 读取 Items 下的数值字段
+     *
+     * 元素不存在或为空时不修改字段；文本不是有效数值时保留原值，由调用方决定如何处理。
+     *
+     * @param name 元素名
+     * @param value 解析结果
+     * @return 解析结果，元素不存在时为 EMPTY
+     */
+    template <typename T>
+    NumberStatus readItem(std::string_view name, T& value) const {
+        const XmlField* field = findItem(name);
+        if (field == nullptr) {
+            return NumberStatus::EMPTY;
+        }
+        return readNumber(field->value, value);
+    }
+};
+
+} // namespace protocol
@@ -0,0 +1,216 @@
+#include "patrol_scanner.hpp"
+#include "xml_document.hpp"
+#include <cstring>
+
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+constexpr std::string_view XML_DECLARATION = "<?xml";
+constexpr std::string_view ROOT_START = "<PatrolDevice>";
+constexpr std::string_view ROOT_END = "</PatrolDevice>";
+constexpr std::string_view ITEMS_END = "</Items>";
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+bool isNameChar(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+           c == '_' || c == '-' || c == '.' || c == ':';
+}
+
+const char* skipSpace(const char* p, const char* end) {
+    while (p < end && isSpace(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+bool startsWith(const char* p, const char* end, std::string_view prefix) {
+    return static_cast<std::size_t>(end - p) >= prefix.size() && std::memcmp(p, prefix.data(), prefix.size()) == 0;
+}
+
+// 解析不带属性的开始标签 <Name> 或 <Name/>，p 指向 '<'；返回标签之后的位置，不符合时返回 nullptr
+const char* readStartTag(const char* p, const char* end, std::string_view& name, bool& selfClosing) {
+    const char* begin = ++p;
+    while (p < end && isNameChar(*p)) {
+        ++p;
+    }
+    name = std::string_view(begin, p - begin);
+    if (name.empty() || p == end) {
+        return nullptr;
+    }
+    if (*p == '>') {
+        selfClosing = false;
+        return p + 1;
+    }
+    if (*p == '/' && end - p >= 2 && p[1] == '>') {
+        selfClosing = true;
+        return p + 2;
+    }
+    return nullptr;
+}
+
+// 读取元素文本和结束标签 </Name>，p 指向开始标签之后；返回结束标签之后的位置，不符合时返回 nullptr
+const char* readText(const char* p, const char* end, std::string_view name, std::string_view& value) {
+    const char* lt = protocol::findChar(p, end, '<');
+    if (lt == end) {
+        return nullptr;
+    }
+    value = std::string_view(p, lt - p);
+    // 实体引用需要解码，交给 XmlDocument（解析时解码实体）
+    if (std::memchr(value.data(), '&', value.size()) != nullptr) {
+        return nullptr;
+    }
+    if (static_cast<std::size_t>(end - lt) < name.size() + 3 || lt[1] != '/' ||
+        std::memcmp(lt + 2, name.data(), name.size()) != 0 || lt[2 + name.size()] != '>') {
+        return nullptr;
+    }
+    return lt + name.size() + 3;
+}
+
+// 扫描 Items 下的元素，p 指向 <Items> 之后；返回 </Items> 之后的位置，不符合时返回 nullptr
+const char* scanItems(const char* p, const char* end, protocol::PatrolFields& fields) {
+    for (;;) {
+        p = skipSpace(p, end);
+        if (p == end || *p != '<') {
+            return nullptr;
+        }
+        if (startsWith(p, end, ITEMS_END)) {
+            return p + ITEMS_END.size();
+        }
+
+        std::string_view name;
+        std::string_view value;
+        bool selfClosing = false;
+        p = readStartTag(p, end, name, selfClosing);
+        if (p == nullptr || (!selfClosing && (p = readText(p, end, name, value)) == nullptr)) {
+            return nullptr;
+        }
+        if (!fields.addItem(name, value)) {
+            return nullptr;
+        }
+    }
+}
+
+}  // namespace
+
+namespace protocol {
+
+const char* findChar(const char* begin, const char* end, char c) {
+    const char* p = begin;
+#if defined(__AVX2__)
+    const __m256i needle32 = _mm256_set1_epi8(c);
+    while (end - p >= 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle32)));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 32;
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i needle16 = _mm_set1_epi8(c);
+    while (end - p >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle16)));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+#elif defined(__ARM_NEON)
+    const uint8x16_t needle16 = vdupq_n_u8(static_cast<uint8_t>(c));
+    while (end - p >= 16) {
+        uint8x16_t eq = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(p)), needle16);
+        // 每个字节的比较结果压缩为4位，得到64位掩码
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        if (mask != 0) {
+            return p + (__builtin_ctzll(mask) >> 2);
+        }
+        p += 16;
+    }
+#endif
+    while (p < end && *p != c) {
+        ++p;
+    }
+    return p;
+}
+
+bool scanPatrolDevice(const char* data, std::size_t size, PatrolFields& fields) {
+    fields.clear();
+    const char* end = data + size;
+    const char* p = skipSpace(data, end);
+
+    // 可选的XML声明 <?xml ... ?>
+    if (startsWith(p, end, XML_DECLARATION)) {
+        const char* gt = findChar(p + XML_DECLARATION.size(), end, '>');
+        if (gt == end || gt[-1] != '?') {
+            return false;
+        }
+        p = skipSpace(gt + 1, end);
+    }
+
+    if (!startsWith(p, end, ROOT_START)) {
+        return false;
+    }
+    p += ROOT_START.size();
+
+    for (;;) {
+        p = skipSpace(p, end);
+        if (p == end || *p != '<') {
+            return false;
+        }
+        if (startsWith(p, end, ROOT_END)) {
+            // 根元素之后只允许空白和结尾的0
+            for (p += ROOT_END.size(); p < end && (isSpace(*p) || *p == '\0'); ++p) {
+            }
+            return p == end;
+        }
+
+        std::string_view name;
+        bool selfClosing = false;
+        p = readStartTag(p, end, name, selfClosing);
+        if (p == nullptr) {
+            return false;
+        }
+        if (name == "Items") {
+            fields.hasItems = true;
+            if (!selfClosing && (p = scanItems(p, end, fields)) == nullptr) {
+                return false;
+            }
+            continue;
+        }
+
+        std::string_view value;
+        if (!selfClosing && (p = readText(p, end, name, value)) == nullptr) {
+            return false;
+        }
+        if (name == "Type") {
+            fields.type = value;
+        } else if (name == "Command") {
+            fields.command = value;
+        } else if (name == "Time") {
+            fields.time = value;
+        }
+    }
+}
+
+bool parsePatrolDevice(const char* data, std::size_t size, PatrolFields& fields) {
+    if (scanPatrolDevice(data, size, fields)) {
+        return true;
+    }
+
+    // 不常见的写法退回通用解析，文档只在第一次退回时创建
+    thread_local XmlDocument document;
+    const rapidxml::xml_node<>* root = document.parse(data, size);
+    return root != nullptr && readPatrolFields(*root, fields);
+}
+
+} // namespace protocol
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "patrol_fields.hpp"
+#include <cstddef>
+
+namespace protocol {
+
+/**
+ * @brief 在 [begin, end) 中查找字符，x86 上使用 SSE2/AVX2、ARM 上使用 NEON 每次比较16/32字节
+ * @return 第一个匹配的位置，没有时返回 end
+ */
+const char* findChar(const char* begin, const char* end, char c);
+
+/**
+ * @brief 专用扫描器：按 PatrolDevice 的固定布局原地扫描消息体，不构建DOM、不分配内存
+ *
+ * 只接受协议的常见写法：可选的XML声明，不带属性的元素，Items 下一层简单元素，文本中没有实体引用。
+ * 其他写法（属性、注释、CDATA、嵌套元素等）返回 false，由调用方退回通用XML解析。
+ *
+ * @param data 消息体地址（不要求以0结尾）
+ * @param size 消息体长度
+ * @param fields 扫描结果，指向 data
+ * @return 消息体是否符合固定布局
+ */
+bool scanPatrolDevice(const char* data, std::size_t size, PatrolFields& fields);
+
+/**
+ * @brief 解析消息体：先用专用扫描器，布局不符合时退回 rapidxml
+ *
+ * 退回 rapidxml 时结果指向本线程复用的XML文档，在本线程下一次调用之前有效。
+ *
+ * @param data 消息体地址（不要求以0结尾）
+ * @param size 消息体长度
+ * @param fields 解析结果
+ * @return 是否为 PatrolDevice 消息；XML格式错误时抛出 rapidxml::parse_error
+ */
+bool parsePatrolDevice(const char* data, std::size_t size, PatrolFields& fields);
+
+} // namespace protocol
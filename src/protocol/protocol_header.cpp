@@ -2,10 +2,6 @@
 #include <algorithm>
 
 namespace {
-constexpr uint8_t HEADER_1 = 0xeb;
-constexpr uint8_t HEADER_2 = 0x90;
-constexpr uint8_t HEADER_3 = 0xeb;
-constexpr uint8_t HEADER_4 = 0x90;
 constexpr uint8_t RESERVED_VALUE = 0x00;
 
 bool isLittleEndian() {
@@ -25,15 +21,20 @@ void toLittleEndian(char* buf, size_t size) {
 namespace protocol {
 
 ProtocolHeader::ProtocolHeader()
-    : sync_byte1(HEADER_1), sync_byte2(HEADER_2), sync_byte3(HEADER_3), sync_byte4(HEADER_4), length(0), sequenceNumber(0) {
+    : sync_byte1(PROTOCOL_SYNC_BYTES[0]),
+      sync_byte2(PROTOCOL_SYNC_BYTES[1]),
+      sync_byte3(PROTOCOL_SYNC_BYTES[2]),
+      sync_byte4(PROTOCOL_SYNC_BYTES[3]),
+      length(0),
+      sequenceNumber(0) {
     reserved.fill(RESERVED_VALUE);
 }
 
 ProtocolHeader::ProtocolHeader(uint16_t length, uint16_t sequenceNumber)
-    : sync_byte1(HEADER_1),
-      sync_byte2(HEADER_2),
-      sync_byte3(HEADER_3),
-      sync_byte4(HEADER_4),
+    : sync_byte1(PROTOCOL_SYNC_BYTES[0]),
+      sync_byte2(PROTOCOL_SYNC_BYTES[1]),
+      sync_byte3(PROTOCOL_SYNC_BYTES[2]),
+      sync_byte4(PROTOCOL_SYNC_BYTES[3]),
       length(length),
       sequenceNumber(sequenceNumber) {
     reserved.fill(RESERVED_VALUE);
@@ -41,7 +42,8 @@ ProtocolHeader::ProtocolHeader(uint16_t length, uint16_t sequenceNumber)
 }
 
 bool ProtocolHeader::validateSyncBytes() const {
-    return sync_byte1 == HEADER_1 && sync_byte2 == HEADER_2 && sync_byte3 == HEADER_3 && sync_byte4 == HEADER_4;
+    return sync_byte1 == PROTOCOL_SYNC_BYTES[0] && sync_byte2 == PROTOCOL_SYNC_BYTES[1] &&
+           sync_byte3 == PROTOCOL_SYNC_BYTES[2] && sync_byte4 == PROTOCOL_SYNC_BYTES[3];
 }
 
 uint16_t ProtocolHeader::getBodySize() const {
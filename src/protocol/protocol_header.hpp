@@ -1,5 +1,6 @@
 #pragma once
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace protocol {
@@ -22,4 +23,10 @@ struct ProtocolHeader {
 };
 #pragma pack(pop)
 
+/// 协议头长度
+constexpr std::size_t PROTOCOL_HEADER_SIZE = sizeof(ProtocolHeader);
+
+/// 协议头同步字节序列
+constexpr std::array<uint8_t, 4> PROTOCOL_SYNC_BYTES = {0xeb, 0x90, 0xeb, 0x90};
+
 }  // namespace protocol
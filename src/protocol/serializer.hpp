@@ -1,12 +1,23 @@
 #pragma once
 
 #include "message_interface.hpp"
+#include "protocol_header.hpp"
 #include <memory>
 #include <string>
 #include <map>
 
 namespace protocol {
 
+/**
+ * @brief 待发送的帧：协议头与消息体分开存放，发送时作为两段缓冲区聚合写出
+ */
+struct SerializedFrame {
+    ProtocolHeader header;  ///< 协议头
+    std::string body;       ///< 消息体
+    MessageType type = MessageType::UNKNOWN; ///< 消息类型，发送队列据此选择排队策略
+    int command = 0;        ///< 命令码（运动控制命令）
+};
+
 /**
  * @brief 协议序列化类
  */
@@ -29,6 +40,15 @@ public:
      */
     std::unique_ptr<IMessage> deserializeMessage(const std::string& data);
 
+    /**
+     * @brief 解析一个已由帧解码器切分好的完整帧
+     * @param header 协议头
+     * @param body 消息体地址
+     * @param size 消息体长度
+     * @return 解析出的消息对象
+     */
+    std::unique_ptr<IMessage> deserializeFrame(const ProtocolHeader& header, const char* body, std::size_t size);
+
     /**
      * @brief 序列化消息为发送数据
      * @param message 要发送的消息
@@ -36,27 +56,30 @@ public:
      */
     std::string serializeMessage(const IMessage& message);
 
-private:
     /**
-     * @brief 从数据中提取消息类型
-     * @param data 接收到的数据
-     * @return 消息类型
+     * @brief 序列化消息为协议头和消息体两部分，不拼接、不拷贝消息体
+     * @param message 要发送的消息
+     * @return 序列化后的帧
      */
-    MessageType extractMessageType(const std::string& data);
+    SerializedFrame serializeFrame(const IMessage& message);
 
     /**
-     * @brief 从XML数据中提取Type字段的值
-     * @param data XML数据
-     * @return Type字段的值，如果提取失败则返回0
+     * @brief 序列化消息到已有的帧，消息体写入 frame.body 并复用其容量
+     *
+     * 发送路径传入从缓冲区池取出的帧，容量足够时不分配内存。
+     *
+     * @param message 要发送的消息
+     * @param frame 输出参数，原有的消息体内容被覆盖
      */
-    int extractTypeFromXml(const std::string& data);
+    void serializeFrame(const IMessage& message, SerializedFrame& frame);
 
+private:
     /**
-     * @brief 从XML数据中提取Command字段的值
-     * @param data XML数据
-     * @return Command字段的值，如果提取失败则返回0
+     * @brief 从已解析的消息体中提取消息类型
+     * @param fields 消息体的扁平视图
+     * @return 消息类型
      */
-    int extractCommandFromXml(const std::string& data);
+    MessageType extractMessageType(const PatrolFields& fields);
 
     /**
      * @brief 根据Type值确定消息类型
@@ -65,8 +88,8 @@ private:
      */
     MessageType determineMessageType(int type);
 
-    // Type值到消息类型的映射
-    const std::map<int, MessageType> type_to_message_type_ = {
+    // Type值到消息类型的映射，所有实例共用，构造 Serializer 不分配内存
+    static inline const std::map<int, MessageType> type_to_message_type_ = {
         {1002, MessageType::GET_REAL_TIME_STATUS_RESP},
         {1003, MessageType::NAVIGATION_TASK_RESP},
         {1004, MessageType::CANCEL_TASK_RESP},
@@ -0,0 +1,41 @@
+#include "xml_document.hpp"
+
+namespace protocol {
+
+const rapidxml::xml_node<>* XmlDocument::parse(const char* data, std::size_t size) {
+    // xml_document::parse 只删除节点，不回收内存池，clear() 才会把内存池恢复到内置的静态块
+    doc_.clear();
+
+    // rapidxml 要求以0结尾的可写缓冲区；缓冲区是副本，使用默认模式原地解码实体引用，节点值指向缓冲区内部
+    buffer_.assign(data, data + size);
+    buffer_.push_back('\0');
+    doc_.parse<0>(buffer_.data());
+
+    return doc_.first_node("PatrolDevice");
+}
+
+bool readPatrolFields(const rapidxml::xml_node<>& root, PatrolFields& fields) {
+    auto text = [](const rapidxml::xml_node<>* node) {
+        return node ? std::string_view(node->value(), node->value_size()) : std::string_view();
+    };
+
+    fields.clear();
+    fields.type = text(root.first_node("Type"));
+    fields.command = text(root.first_node("Command"));
+    fields.time = text(root.first_node("Time"));
+
+    const rapidxml::xml_node<>* items = root.first_node("Items");
+    if (!items) {
+        return true;
+    }
+    fields.hasItems = true;
+    for (const rapidxml::xml_node<>* node = items->first_node(); node; node = node->next_sibling()) {
+        if (node->type() == rapidxml::node_element &&
+            !fields.addItem(std::string_view(node->name(), node->name_size()), text(node))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace protocol
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "patrol_fields.hpp"
+#include <rapidxml/rapidxml.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace protocol {
+
+/**
+ * @brief 可重复使用的XML文档，专用扫描器不接受的消息体退回到这里解析
+ *
+ * 缓冲区和 rapidxml 的内存池在多次解析间复用，达到稳定大小后解析不再分配内存。节点指向内部缓冲区，在下一次 parse() 之前有效。
+ * 节点值中的实体引用（如 &amp;）已解码，专用扫描器遇到实体引用时退回到这里。
+ * 不是线程安全的，接收路径按线程各持有一个。
+ */
+class XmlDocument {
+public:
+    XmlDocument() = default;
+    XmlDocument(const XmlDocument&) = delete;
+    XmlDocument& operator=(const XmlDocument&) = delete;
+
+    /**
+     * @brief 解析消息体
+     * @param data 消息体地址（不要求以0结尾）
+     * @param size 消息体长度
+     * @return PatrolDevice 根节点，不存在时返回 nullptr；XML格式错误时抛出 rapidxml::parse_error
+     */
+    const rapidxml::xml_node<>* parse(const char* data, std::size_t size);
+
+private:
+    std::vector<char> buffer_;
+    rapidxml::xml_document<> doc_;
+};
+
+/**
+ * @brief 把通用XML解析的结果转换为扁平视图
+ * @param root PatrolDevice 根节点
+ * @param fields 转换结果，指向 XmlDocument 的缓冲区
+ * @return Items 下的元素超过 PatrolFields::MAX_ITEMS 时返回 false
+ */
+bool readPatrolFields(const rapidxml::xml_node<>& root, PatrolFields& fields);
+
+} // namespace protocol
@@ -0,0 +1,1234 @@
+#pragma once
+
+#include <robotserver_sdk.h>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <ctime>
+#include <future>
+#include <map>
+#include <variant>
+#include <thread>
+
+#include "callback_executor.hpp"
+#include "network/dual_connection_network_model.hpp"
+#include "network/reconnecting_network_model.hpp"
+#include "sdk_runtime_impl.hpp"
+#include "protocol/messages.hpp"
+
+namespace robotserver_sdk {
+
+/**
+ * @brief 作用域保护类
+ * @tparam F 函数类型
+ */
+template <typename F>
+class ScopeGuard {
+    F f_;
+public:
+    ScopeGuard(F f) : f_(std::move(f)) {}
+    ~ScopeGuard() { f_(); }
+
+    // 禁止复制和移动
+    ScopeGuard(const ScopeGuard&) = delete;
+    ScopeGuard& operator=(const ScopeGuard&) = delete;
+    ScopeGuard(ScopeGuard&&) = delete;
+    ScopeGuard& operator=(ScopeGuard&&) = delete;
+};
+
+/**
+ * @brief 创建作用域保护类
+ * @tparam F 函数类型
+ * @param f 函数对象
+ * @return 作用域保护类
+ */
+template <typename F>
+ScopeGuard<F> makeScopeGuard(F f) {
+    return ScopeGuard<F>(std::move(f));
+}
+
+/**
+ * @brief 安全回调包装函数，用于捕获和处理用户回调函数中可能抛出的异常
+ * @tparam Callback 回调函数类型
+ * @tparam Args 回调函数参数类型
+ * @param callback 用户回调函数
+ * @param callbackType 回调函数类型描述，用于日志记录
+ * @param args 回调函数参数
+ */
+template<typename Callback, typename... Args>
+void safeCallback(const Callback& callback, const std::string& callbackType, Args&&... args) {
+    if (!callback) {
+        return;
+    }
+
+    try {
+        callback(std::forward<Args>(args)...);
+    } catch (const std::exception& e) {
+        auto now = std::chrono::system_clock::now();
+        auto time_t_now = std::chrono::system_clock::to_time_t(now);
+        std::stringstream ss;
+        ss << std::put_time(std::localtime(&time_t_now), "%Y-%m-%d %H:%M:%S");
+
+        std::cerr << "[" << ss.str() << "] " << callbackType << " 回调函数异常: " << e.what() << std::endl;
+    } catch (...) {
+        auto now = std::chrono::system_clock::now();
+        auto time_t_now = std::chrono::system_clock::to_time_t(now);
+        std::stringstream ss;
+        ss << std::put_time(std::localtime(&time_t_now), "%Y-%m-%d %H:%M:%S");
+
+        std::cerr << "[" << ss.str() << "] " << callbackType << " 回调函数发生未知异常" << std::endl;
+    }
+}
+
+inline RealTimeStatus convertToRealTimeStatus(const protocol::GetRealTimeStatusResponse& realTimeResp) {
+    RealTimeStatus status;
+    status.motionState = realTimeResp.motionState;
+    status.posX = realTimeResp.posX;
+    status.posY = realTimeResp.posY;
+    status.posZ = realTimeResp.posZ;
+    status.angleYaw = realTimeResp.angleYaw;
+    status.roll = realTimeResp.roll;
+    status.pitch = realTimeResp.pitch;
+    status.yaw = realTimeResp.yaw;
+    status.speed = realTimeResp.speed;
+    status.curOdom = realTimeResp.curOdom;
+    status.sumOdom = realTimeResp.sumOdom;
+    status.curRuntime = realTimeResp.curRuntime;
+    status.sumRuntime = realTimeResp.sumRuntime;
+    status.res = realTimeResp.res;
+    status.x0 = realTimeResp.x0;
+    status.y0 = realTimeResp.y0;
+    status.h = realTimeResp.h;
+    status.electricity = realTimeResp.electricity;
+    status.location = realTimeResp.location;
+    status.RTKState = realTimeResp.RTKState;
+    status.onDockState = realTimeResp.onDockState;
+    status.gaitState = realTimeResp.gaitState;
+    status.motorState = realTimeResp.motorState;
+    status.chargeState = realTimeResp.chargeState;
+    status.controlMode = realTimeResp.controlMode;
+    status.mapUpdateState = realTimeResp.mapUpdateState;
+    status.invalidFieldCount = static_cast<int>(realTimeResp.invalidFieldCount);
+
+    return status;
+}
+
+inline RTKFusionData convertToRTKFusionData(const protocol::RTKFusionDataResponse& rtkFusionResp) {
+    RTKFusionData data;
+    data.longitude = rtkFusionResp.longitude;
+    data.latitude = rtkFusionResp.latitude;
+    data.elpHeight = rtkFusionResp.elpHeight;
+    data.yaw = rtkFusionResp.yaw;
+    data.invalidFieldCount = static_cast<int>(rtkFusionResp.invalidFieldCount);
+
+    return data;
+}
+
+inline RTKRawData convertToRTKRawData(const protocol::RTKRawDataResponse& rtkRawResp) {
+    RTKRawData data;
+    data.longitude = rtkRawResp.longitude;
+    data.latitude = rtkRawResp.latitude;
+    data.elpHeight = rtkRawResp.elpHeight;
+    data.yaw = rtkRawResp.yaw;
+    data.invalidFieldCount = static_cast<int>(rtkRawResp.invalidFieldCount);
+
+    return data;
+}
+
+// SDK实现类
+class RobotServerSdkImpl : public network::INetworkCallback {
+public:
+    RobotServerSdkImpl(const SdkOptions& options)
+        : options_(options),
+          runtime_(options.runtime ? options.runtime
+                                   : std::make_shared<SdkRuntime>(options.callerDrivenIo ? 0 : 1, options.busyPoll,
+                                                                  options.threads)),
+          callbacks_(options.callbacks,
+                     options.callbacks.execution == CallbackExecution::DEDICATED_THREAD
+                         ? runtime_->impl_->callbackThread() : nullptr,
+                     options.callbacks.execution == CallbackExecution::EVENT_FD
+                         ? runtime_->impl_->completionQueue() : nullptr) {
+        // 传输层外包一层自动重连，传输层的回调先经过重连状态机再到达本对象
+        network_model_ = std::make_shared<network::ReconnectingNetworkModel>(
+            *this, runtime_->impl_->io_pool, options_.reconnect);
+
+        if (runtime_->impl_->io_pool->callerDriven() &&
+            (options_.transport == TransportBackend::EPOLL || options_.transport == TransportBackend::IO_URING)) {
+            std::cerr << "epoll/io_uring传输在自己的反应器线程中收发，调用方驱动IO时改用ASIO传输" << std::endl;
+            options_.transport = TransportBackend::ASIO;
+        }
+        if (options.runtime && options.callerDrivenIo && !runtime_->impl_->io_pool->callerDriven()) {
+            std::cerr << "共享的运行时有IO线程，callerDrivenIo 不生效" << std::endl;
+        }
+        if (options.runtime && options.busyPoll.enabled) {
+            std::cerr << "使用共享的运行时时 busyPoll 不生效，请在创建运行时时配置" << std::endl;
+        }
+        if (options.runtime && (!options.threads.cpuAffinity.empty() ||
+                                options.threads.policy != ThreadSchedulingPolicy::DEFAULT)) {
+            std::cerr << "使用共享的运行时时 threads 不生效，请在创建运行时时配置" << std::endl;
+        }
+
+        if (options_.dedicatedControlConnection && options_.transport == TransportBackend::SHARED_MEMORY) {
+            std::cerr << "共享内存段只允许一个客户端挂接，不建立独立的控制连接" << std::endl;
+            options_.dedicatedControlConnection = false;
+        }
+
+        if (options_.dedicatedControlConnection) {
+            // 重连状态机包装双连接，两条连接共同重连
+            dual_model_ = std::make_shared<network::DualConnectionNetworkModel>(*network_model_, runtime_->impl_->io_pool);
+            dual_model_->setTransports(runtime_->impl_->createTransport(*dual_model_, options_),
+                                       runtime_->impl_->createTransport(*dual_model_, options_));
+            network_model_->setTransport(dual_model_);
+        } else {
+            network_model_->setTransport(runtime_->impl_->createTransport(*network_model_, options_));
+        }
+    }
+
+    ~RobotServerSdkImpl() {
+        // 析构过程中不再回调用户
+        {
+            std::lock_guard<std::mutex> lock(connection_state_callback_mutex_);
+            connection_state_callback_ = nullptr;
+        }
+
+        // 关闭网络层的回调闸门，等待其他线程中正在回调本对象的处理函数结束，之后不会再回调本对象
+        network_model_->detachCallback();
+        network_model_->disconnect();
+
+        // 已派发的用户回调可能引用调用方的对象，等待它们执行完
+        callbacks_.waitIdle();
+    }
+
+    bool connect(const std::string& host, uint16_t port) {
+        try {
+            if (isConnected()) {
+                return true;
+            }
+
+            return network_model_->connect(host, port);
+        } catch (const std::exception& e) {
+            std::cerr << "connect 异常: " << e.what() << std::endl;
+            return false;
+        } catch (...) {
+            std::cerr << "connect 未知异常" << std::endl;
+            return false;
+        }
+    }
+    void connectAsync(const std::string& host, uint16_t port, ConnectResultCallback callback) {
+        try {
+            // 保留 callback 供下面的异常分支通知失败
+            network_model_->connectAsync(host, port, [this, callback](bool connected) {
+                dispatchCallback(callback, "连接结果", connected);
+            });
+        } catch (const std::exception& e) {
+            std::cerr << "connectAsync 异常: " << e.what() << std::endl;
+            safeCallback(callback, "连接结果", false);
+        } catch (...) {
+            std::cerr << "connectAsync 未知异常" << std::endl;
+            safeCallback(callback, "连接结果", false);
+        }
+    }
+
+    /**
+     * @brief 异步连接，结果在IO线程中直接通知，不经过用户回调的派发方式
+     *
+     * 供 FleetSdk 内部等待连接完成：EVENT_FD 方式下派发的结果要等调用方 drainCompletions() 才执行，
+     * 内部的同步等待会一直阻塞。
+     */
+    void connectAsyncInternal(const std::string& host, uint16_t port, ConnectResultCallback callback) {
+        try {
+            network_model_->connectAsync(host, port, callback);
+        } catch (const std::exception& e) {
+            std::cerr << "connectAsync 异常: " << e.what() << std::endl;
+            safeCallback(callback, "连接结果", false);
+        } catch (...) {
+            std::cerr << "connectAsync 未知异常" << std::endl;
+            safeCallback(callback, "连接结果", false);
+        }
+    }
+
+    /**
+     * @brief 当前线程是否为运行时的IO线程或事件循环线程，在其中同步等待连接完成会死锁
+     */
+    bool runningInIoThread() const {
+        return runtime_->impl_->runningInThisThread();
+    }
+
+    void disconnect() {
+        try {
+            // 正在自动重连时也需要断开以取消重连
+            if (network_model_->state() == ConnectionState::DISCONNECTED) {
+                return;
+            }
+
+            network_model_->disconnect();
+        } catch (const std::exception& e) {
+            std::cerr << "disconnect 异常: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "disconnect 未知异常" << std::endl;
+        }
+    }
+
+    bool isConnected() const {
+        try {
+            return network_model_->isConnected();
+        } catch (const std::exception& e) {
+            std::cerr << "isConnected 异常: " << e.what() << std::endl;
+            return false;
+        } catch (...) {
+            std::cerr << "isConnected 未知异常" << std::endl;
+            return false;
+        }
+    }
+
+    ConnectionState getConnectionState() const {
+        return network_model_->state();
+    }
+
+    void setConnectionStateCallback(ConnectionStateCallback callback) {
+        std::lock_guard<std::mutex> lock(connection_state_callback_mutex_);
+        connection_state_callback_ = std::move(callback);
+    }
+
+    CallbackStatistics getCallbackStatistics() const {
+        return callbacks_.statistics();
+    }
+
+    std::vector<ThreadStatus> getThreadStatus() const {
+        return runtime_->threadStatus();
+    }
+
+    int completionEventFd() {
+        return runtime_->completionEventFd();
+    }
+
+    std::size_t drainCompletions() {
+        return runtime_->drainCompletions();
+    }
+
+    std::size_t poll(std::chrono::milliseconds timeout) {
+        const auto& pool = runtime_->impl_->io_pool;
+        return pool->callerDriven() ? pool->poll(timeout) : 0;
+    }
+
+    int nativeHandle(ConnectionChannel channel) const {
+        return dual_model_ ? dual_model_->channelNativeHandle(channel) : network_model_->nativeHandle();
+    }
+
+    ConnectionStatistics getConnectionStatistics() const {
+        ConnectionStatistics stats = network_model_->getStatistics();
+        std::lock_guard<std::mutex> lock(rtt_mutex_);
+        rtt_[0].fill(stats);
+        return stats;
+    }
+
+    ConnectionStatistics getConnectionStatistics(ConnectionChannel channel) const {
+        // 单连接时两个通道是同一条连接
+        if (!dual_model_) {
+            return getConnectionStatistics();
+        }
+
+        ConnectionStatistics stats = dual_model_->getChannelStatistics(channel);
+        stats.reconnectCount = network_model_->getStatistics().reconnectCount;
+        std::lock_guard<std::mutex> lock(rtt_mutex_);
+        rtt_[rttIndex(channel)].fill(stats);
+        return stats;
+    }
+
+    /**
+     * @brief 已发出请求的凭据
+     *
+     * 同步请求拆分为 begin（发出请求）和 finish（等待响应）两步，
+     * 批量操作可以先向多台机器狗发出请求，再用同一个截止时间统一等待。
+     */
+    struct RequestTicket {
+        uint16_t seqNum = 0;         ///< 请求序列号
+        bool sent = false;           ///< 是否已发出，未连接时为false
+        std::future<bool> future;    ///< 响应到达通知
+    };
+
+    RealTimeStatus request1002_RunTimeState() {
+        try {
+            RequestTicket ticket = begin1002_RunTimeState();
+            return finish1002_RunTimeState(ticket, std::chrono::steady_clock::now() + options_.requestTimeout);
+        } catch (const std::exception& e) {
+            std::cerr << "request1002_RunTimeState 异常: " << e.what() << std::endl;
+            RealTimeStatus status;
+            status.errorCode = ErrorCode_RealTimeStatus::UNKNOWN_ERROR;
+            return status;
+        } catch (...) {
+            std::cerr << "request1002_RunTimeState 未知异常" << std::endl;
+            RealTimeStatus status;
+            status.errorCode = ErrorCode_RealTimeStatus::UNKNOWN_ERROR;
+            return status;
+        }
+    }
+
+    RequestTicket begin1002_RunTimeState() {
+        // 创建请求消息
+        protocol::GetRealTimeStatusRequest request;
+
+        return submitRequest(request, protocol::MessageType::GET_REAL_TIME_STATUS_RESP);
+    }
+
+    RealTimeStatus finish1002_RunTimeState(RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+        RealTimeStatus status;
+        if (!ticket.sent) {
+            status.errorCode = ErrorCode_RealTimeStatus::NOT_CONNECTED;
+            return status;
+        }
+
+        // 等待响应
+        AwaitResult awaitResult = AwaitResult::RESPONDED;
+        auto realTimeResp = awaitResponse<protocol::GetRealTimeStatusResponse>(ticket, deadline, awaitResult);
+        if (awaitResult == AwaitResult::TIMEOUT) {
+            status.errorCode = ErrorCode_RealTimeStatus::TIMEOUT;
+            return status;
+        }
+        if (awaitResult == AwaitResult::CONNECTION_LOST) {
+            status.errorCode = ErrorCode_RealTimeStatus::NOT_CONNECTED;
+            return status;
+        }
+        if (awaitResult == AwaitResult::DROPPED) {
+            status.errorCode = ErrorCode_RealTimeStatus::DROPPED;
+            return status;
+        }
+        if (!realTimeResp) {
+            status.errorCode = ErrorCode_RealTimeStatus::INVALID_RESPONSE;
+            return status;
+        }
+
+        // 转换为SDK的RealTimeStatus
+        return convertToRealTimeStatus(*realTimeResp);
+    }
+
+    // 添加基于回调的异步方法实现
+    void request1003_StartNavTask(const std::vector<NavigationPoint>& points, NavigationResultCallback callback) {
+        try {
+            if (!callback || points.empty()) {
+                NavigationResult failResult;
+                failResult.errorCode = ErrorCode_Navigation::INVALID_PARAM;
+                safeCallback(callback, "导航结果", failResult);
+                return;
+            }
+
+            if (!isConnected()) {
+                NavigationResult failResult;
+                failResult.errorCode = ErrorCode_Navigation::NOT_CONNECTED;
+                safeCallback(callback, "导航结果", failResult);
+                return;
+            }
+
+            // 创建请求消息
+            protocol::NavigationTaskRequest request;
+
+            // 生成并设置序列号
+            uint16_t seqNum = generateSequenceNumber();
+            request.setSequenceNumber(seqNum);
+
+            // 转换导航点
+            for (const auto& point : points) {
+                protocol::NavigationPoint proto_point;
+                proto_point.mapId = point.mapId;
+                proto_point.value = point.value;
+                proto_point.posX = point.posX;
+                proto_point.posY = point.posY;
+                proto_point.posZ = point.posZ;
+                proto_point.angleYaw = point.angleYaw;
+                proto_point.pointInfo = point.pointInfo;
+                proto_point.gait = point.gait;
+                proto_point.speed = point.speed;
+                proto_point.manner = point.manner;
+                proto_point.obsMode = point.obsMode;
+                proto_point.navMode = point.navMode;
+                proto_point.terrain = point.terrain;
+                proto_point.posture = point.posture;
+                request.points.push_back(proto_point);
+            }
+
+            // 保存回调函数
+            {
+                std::lock_guard<std::mutex> lock(navigation_result_callbacks_mutex_);
+                navigation_result_callbacks_[seqNum] = std::move(callback);
+            }
+
+            // 发送请求
+            network_model_->sendMessage(request);
+        } catch (const std::exception& e) {
+            std::cerr << "request1003_StartNavTask 异常: " << e.what() << std::endl;
+            NavigationResult failResult;
+            failResult.errorCode = ErrorCode_Navigation::UNKNOWN_ERROR;
+            safeCallback(callback, "导航结果", failResult);
+        } catch (...) {
+            std::cerr << "request1003_StartNavTask 未知异常" << std::endl;
+            NavigationResult failResult;
+            failResult.errorCode = ErrorCode_Navigation::UNKNOWN_ERROR;
+            safeCallback(callback, "导航结果", failResult);
+        }
+    }
+
+    bool request1004_CancelNavTask() {
+        try {
+            RequestTicket ticket = begin1004_CancelNavTask();
+            return finish1004_CancelNavTask(ticket, std::chrono::steady_clock::now() + options_.requestTimeout);
+        } catch (const std::exception& e) {
+            std::cerr << "request1004_CancelNavTask 异常: " << e.what() << std::endl;
+            return false;
+        } catch (...) {
+            std::cerr << "request1004_CancelNavTask 未知异常" << std::endl;
+            return false;
+        }
+    }
+
+    RequestTicket begin1004_CancelNavTask() {
+        // 创建请求消息
+        protocol::CancelTaskRequest request;
+
+        return submitRequest(request, protocol::MessageType::CANCEL_TASK_RESP);
+    }
+
+    bool finish1004_CancelNavTask(RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+        if (!ticket.sent) {
+            return false;
+        }
+
+        // 等待响应
+        AwaitResult awaitResult = AwaitResult::RESPONDED;
+        auto response = awaitResponse<protocol::CancelTaskResponse>(ticket, deadline, awaitResult);
+
+        return response && response->errorCode == protocol::ErrorCode_CancelTask::SUCCESS;
+    }
+
+    TaskStatusResult request1007_NavTaskState() {
+        try {
+            RequestTicket ticket = begin1007_NavTaskState();
+            return finish1007_NavTaskState(ticket, std::chrono::steady_clock::now() + options_.requestTimeout);
+        } catch (const std::exception& e) {
+            std::cerr << "request1007_NavTaskState 异常: " << e.what() << std::endl;
+            TaskStatusResult result;
+            result.errorCode = ErrorCode_QueryStatus::UNKNOWN_ERROR;
+            return result;
+        } catch (...) {
+            std::cerr << "request1007_NavTaskState 未知异常" << std::endl;
+            TaskStatusResult result;
+            result.errorCode = ErrorCode_QueryStatus::UNKNOWN_ERROR;
+            return result;
+        }
+    }
+
+    RequestTicket begin1007_NavTaskState() {
+        // 创建请求消息
+        protocol::QueryStatusRequest request;
+
+        return submitRequest(request, protocol::MessageType::QUERY_STATUS_RESP);
+    }
+
+    TaskStatusResult finish1007_NavTaskState(RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+        TaskStatusResult result;
+        if (!ticket.sent) {
+            result.errorCode = ErrorCode_QueryStatus::NOT_CONNECTED;
+            return result;
+        }
+
+        // 等待响应
+        AwaitResult awaitResult = AwaitResult::RESPONDED;
+        auto queryStatusResp = awaitResponse<protocol::QueryStatusResponse>(ticket, deadline, awaitResult);
+        if (awaitResult == AwaitResult::TIMEOUT) {
+            result.errorCode = ErrorCode_QueryStatus::TIMEOUT;
+            return result;
+        }
+        if (awaitResult == AwaitResult::CONNECTION_LOST) {
+            result.errorCode = ErrorCode_QueryStatus::NOT_CONNECTED;
+            return result;
+        }
+        if (awaitResult == AwaitResult::DROPPED) {
+            result.errorCode = ErrorCode_QueryStatus::DROPPED;
+            return result;
+        }
+        if (!queryStatusResp) {
+            result.errorCode = ErrorCode_QueryStatus::INVALID_RESPONSE;
+            return result;
+        }
+
+        // 转换为SDK的TaskStatusResult
+        result.status = static_cast<Status_QueryStatus>(queryStatusResp->status);
+        result.errorCode = static_cast<ErrorCode_QueryStatus>(queryStatusResp->errorCode);
+        result.value = queryStatusResp->value;
+
+        return result;
+    }
+
+    RTKFusionData request2102_RTKFusionData() {
+        try {
+            RequestTicket ticket = begin2102_RTKFusionData();
+            return finish2102_RTKFusionData(ticket, std::chrono::steady_clock::now() + options_.requestTimeout);
+        } catch (const std::exception& e) {
+            std::cerr << "request2102_RTKFusionData 异常: " << e.what() << std::endl;
+            RTKFusionData data;
+            data.errorCode = ErrorCode_RTKFusion::UNKNOWN_ERROR;
+            return data;
+        } catch (...) {
+            std::cerr << "request2102_RTKFusionData 未知异常" << std::endl;
+            RTKFusionData data;
+            data.errorCode = ErrorCode_RTKFusion::UNKNOWN_ERROR;
+            return data;
+        }
+    }
+
+    RequestTicket begin2102_RTKFusionData() {
+        // 创建请求消息
+        protocol::RTKFusionDataRequest request;
+
+        return submitRequest(request, protocol::MessageType::RTK_FUSION_DATA_RESP);
+    }
+
+    RTKFusionData finish2102_RTKFusionData(RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+        RTKFusionData data;
+        if (!ticket.sent) {
+            data.errorCode = ErrorCode_RTKFusion::NOT_CONNECTED;
+            return data;
+        }
+
+        // 等待响应
+        AwaitResult awaitResult = AwaitResult::RESPONDED;
+        auto rtkFusionResp = awaitResponse<protocol::RTKFusionDataResponse>(ticket, deadline, awaitResult);
+        if (awaitResult == AwaitResult::TIMEOUT) {
+            data.errorCode = ErrorCode_RTKFusion::TIMEOUT;
+            return data;
+        }
+        if (awaitResult == AwaitResult::CONNECTION_LOST) {
+            data.errorCode = ErrorCode_RTKFusion::NOT_CONNECTED;
+            return data;
+        }
+        if (awaitResult == AwaitResult::DROPPED) {
+            data.errorCode = ErrorCode_RTKFusion::DROPPED;
+            return data;
+        }
+        if (!rtkFusionResp) {
+            data.errorCode = ErrorCode_RTKFusion::INVALID_RESPONSE;
+            return data;
+        }
+
+        // 转换为SDK的RTKFusionData
+        return convertToRTKFusionData(*rtkFusionResp);
+    }
+
+    RTKRawData request2103_RTKRawData() {
+        try {
+            RequestTicket ticket = begin2103_RTKRawData();
+            return finish2103_RTKRawData(ticket, std::chrono::steady_clock::now() + options_.requestTimeout);
+        } catch (const std::exception& e) {
+            std::cerr << "request2103_RTKRawData 异常: " << e.what() << std::endl;
+            RTKRawData data;
+            data.errorCode = ErrorCode_RTKRaw::UNKNOWN_ERROR;
+            return data;
+        } catch (...) {
+            std::cerr << "request2103_RTKRawData 未知异常" << std::endl;
+            RTKRawData data;
+            data.errorCode = ErrorCode_RTKRaw::UNKNOWN_ERROR;
+            return data;
+        }
+    }
+
+    RequestTicket begin2103_RTKRawData() {
+        // 创建请求消息
+        protocol::RTKRawDataRequest request;
+
+        return submitRequest(request, protocol::MessageType::RTK_RAW_DATA_RESP);
+    }
+
+    RTKRawData finish2103_RTKRawData(RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+        RTKRawData data;
+        if (!ticket.sent) {
+            data.errorCode = ErrorCode_RTKRaw::NOT_CONNECTED;
+            return data;
+        }
+
+        // 等待响应
+        AwaitResult awaitResult = AwaitResult::RESPONDED;
+        auto rtkRawResp = awaitResponse<protocol::RTKRawDataResponse>(ticket, deadline, awaitResult);
+        if (awaitResult == AwaitResult::TIMEOUT) {
+            data.errorCode = ErrorCode_RTKRaw::TIMEOUT;
+            return data;
+        }
+        if (awaitResult == AwaitResult::CONNECTION_LOST) {
+            data.errorCode = ErrorCode_RTKRaw::NOT_CONNECTED;
+            return data;
+        }
+        if (awaitResult == AwaitResult::DROPPED) {
+            data.errorCode = ErrorCode_RTKRaw::DROPPED;
+            return data;
+        }
+        if (!rtkRawResp) {
+            data.errorCode = ErrorCode_RTKRaw::INVALID_RESPONSE;
+            return data;
+        }
+
+        // 转换为SDK的RTKRawData
+        return convertToRTKRawData(*rtkRawResp);
+    }
+
+    // 实现网络回调接口
+    void onMessageReceived(std::unique_ptr<protocol::IMessage> message) override {
+        try {
+            if (!message) {
+                return;
+            }
+
+            uint16_t seqNum = message->getSequenceNumber();
+            protocol::MessageType msgType = message->getType();
+
+            if (msgType == protocol::MessageType::NAVIGATION_TASK_RESP) {
+                // 检查是否有等待此响应的请求
+                NavigationResultCallback callback{};
+                {
+                    std::lock_guard<std::mutex> lock(navigation_result_callbacks_mutex_);
+                    auto callbackIt = navigation_result_callbacks_.find(seqNum);
+                    if (callbackIt != navigation_result_callbacks_.end()) {
+                        callback = callbackIt->second;
+                        navigation_result_callbacks_.erase(callbackIt);
+                    }
+                }
+
+                // 如果有回调，则使用安全回调包装函数调用
+                if (callback) {
+                    auto* resp = dynamic_cast<protocol::NavigationTaskResponse*>(message.get());
+                    if (resp) {
+                        NavigationResult result;
+                        result.value = resp->value;
+                        result.errorCode = static_cast<ErrorCode_Navigation>(resp->errorCode);
+                        result.errorStatus = static_cast<ErrorStatus_Navigation>(resp->errorStatus);
+                        dispatchCallback(std::move(callback), "导航结果", result);
+                    }
+                }
+
+                return;
+            }
+
+            // 处理其他类型的响应消息
+            {
+                std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+                auto it = pendingRequests_.find(seqNum);
+                if (it != pendingRequests_.end() && it->second.expectedResponseType == msgType) {
+                    recordRtt(it->second);
+                    it->second.response = std::move(message);
+                    it->second.responseReceived = true;
+
+                    // 使用promise通知等待线程
+                    try {
+                        it->second.promise->set_value(true);
+                    } catch (const std::future_error&) {
+                        // 忽略已经设置过值的promise
+                    }
+                }
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "onMessageReceived 异常: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "onMessageReceived 未知异常" << std::endl;
+        }
+    }
+
+    void onSendFailed(uint16_t seqNum) override {
+        try {
+            // 导航任务立即以失败结束
+            NavigationResultCallback callback{};
+            {
+                std::lock_guard<std::mutex> lock(navigation_result_callbacks_mutex_);
+                auto callbackIt = navigation_result_callbacks_.find(seqNum);
+                if (callbackIt != navigation_result_callbacks_.end()) {
+                    callback = std::move(callbackIt->second);
+                    navigation_result_callbacks_.erase(callbackIt);
+                }
+            }
+            if (callback) {
+                NavigationResult failResult;
+                failResult.errorCode = ErrorCode_Navigation::DROPPED;
+                dispatchCallback(std::move(callback), "导航结果", failResult);
+                return;
+            }
+
+            // 等待响应的请求不必等到超时
+            std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+            auto it = pendingRequests_.find(seqNum);
+            if (it != pendingRequests_.end() && !it->second.responseReceived) {
+                it->second.dropped = true;
+                try {
+                    it->second.promise->set_value(false);
+                } catch (const std::future_error&) {
+                    // 忽略已经设置过值的promise
+                }
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "onSendFailed 异常: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "onSendFailed 未知异常" << std::endl;
+        }
+    }
+
+    void onConnectionStateChanged(ConnectionState state) override {
+        try {
+            ConnectionState previous = connection_state_.exchange(state);
+            bool replay = options_.reconnect.pendingRequestPolicy == PendingRequestPolicy::REPLAY;
+
+            if (state == ConnectionState::RECONNECTING && previous == ConnectionState::CONNECTED) {
+                // 连接丢失，按策略保留可重发的请求，其余立即失败
+                failPendingRequests(replay);
+            } else if (state == ConnectionState::DISCONNECTED && previous != ConnectionState::DISCONNECTED) {
+                // 连接丢失且不再重连，或重连放弃 / 被主动断开
+                failPendingRequests(false);
+            } else if (state == ConnectionState::CONNECTED && previous == ConnectionState::RECONNECTING && replay) {
+                replayPendingRequests();
+            }
+
+            ConnectionStateCallback callback;
+            {
+                std::lock_guard<std::mutex> lock(connection_state_callback_mutex_);
+                callback = connection_state_callback_;
+            }
+            dispatchCallback(std::move(callback), "连接状态变化", state);
+        } catch (const std::exception& e) {
+            std::cerr << "onConnectionStateChanged 异常: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "onConnectionStateChanged 未知异常" << std::endl;
+        }
+    }
+
+    MotionControlResult request2_MotionControl(int command, std::variant<float, int> value) {
+        try {
+            RequestTicket ticket = begin2_MotionControl(command, value);
+            return finish2_MotionControl(ticket, std::chrono::steady_clock::now() + options_.requestTimeout);
+        } catch (const std::exception& e) {
+            std::cerr << "request2_MotionControl 异常: " << e.what() << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        } catch (...) {
+            std::cerr << "request2_MotionControl 未知异常" << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        }
+    }
+
+    RequestTicket begin2_MotionControl(int command, std::variant<float, int> value) {
+        // 创建请求消息
+        protocol::MotionControlRequest request;
+        request.command = command;
+
+        std::visit([&request](auto&& arg) {
+            request.setValue(arg);
+        }, value);
+
+        return submitRequest(request, protocol::MessageType::MOTION_CONTROL_RESP);
+    }
+
+    MotionControlResult finish2_MotionControl(RequestTicket& ticket, std::chrono::steady_clock::time_point deadline) {
+        MotionControlResult result;
+        if (!ticket.sent) {
+            result.errorCode = ErrorCode_MotionControl::NOT_CONNECTED;
+            return result;
+        }
+
+        // 等待响应
+        AwaitResult awaitResult = AwaitResult::RESPONDED;
+        auto response = awaitResponse<protocol::MotionControlResponse>(ticket, deadline, awaitResult);
+        if (awaitResult == AwaitResult::TIMEOUT) {
+            result.errorCode = ErrorCode_MotionControl::TIMEOUT;
+            return result;
+        }
+        if (awaitResult == AwaitResult::CONNECTION_LOST) {
+            result.errorCode = ErrorCode_MotionControl::NOT_CONNECTED;
+            return result;
+        }
+        if (awaitResult == AwaitResult::DROPPED) {
+            result.errorCode = ErrorCode_MotionControl::DROPPED;
+            return result;
+        }
+        if (!response) {
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        }
+
+        // 转换为SDK的MotionControlResult
+        result.value = response->getFloatValue();
+        result.errorCode = static_cast<ErrorCode_MotionControl>(response->errorCode);
+        return result;
+    }
+
+    MotionControlResult request2_SpeedControl(SpeedCommand cmd, float speed) {
+        try {
+            // 频率限制检查
+            auto now = std::chrono::steady_clock::now();
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                now - lastSpeedCommandTime_).count();
+
+            // 确保频率不超过5Hz (200ms)
+            if (elapsed < 200) {
+                MotionControlResult result;
+                result.errorCode = ErrorCode_MotionControl::TOO_FREQUENT;
+                return result;
+            }
+
+            // 更新时间戳
+            lastSpeedCommandTime_ = now;
+
+            // 发送命令
+            return request2_MotionControl(static_cast<int>(cmd), speed);
+        } catch (const std::exception& e) {
+            std::cerr << "request2_SpeedControl 异常: " << e.what() << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        } catch (...) {
+            std::cerr << "request2_SpeedControl 未知异常" << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        }
+    }
+
+    MotionControlResult request2_ActionControl(ActionCommand cmd) {
+        try {
+            // 动作控制不需要频率限制
+            return request2_MotionControl(static_cast<int>(cmd), 0);
+        } catch (const std::exception& e) {
+            std::cerr << "request2_ActionControl 异常: " << e.what() << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        } catch (...) {
+            std::cerr << "request2_ActionControl 未知异常" << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        }
+    }
+
+    MotionControlResult request2_Configure(ConfigCommand cmd, int value) {
+        try {
+            // 配置命令不需要频率限制
+            return request2_MotionControl(static_cast<int>(cmd), value);
+        } catch (const std::exception& e) {
+            std::cerr << "request2_Configure 异常: " << e.what() << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        } catch (...) {
+            std::cerr << "request2_Configure 未知异常" << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        }
+    }
+
+    MotionControlResult request2_SwitchBodyHeight(int height) {
+        try {
+            // 参数验证
+            if (height != 0 && height != 1) {
+                std::cerr << "request2_SwitchBodyHeight 参数错误: height必须为0(站立)或1(匍匐)" << std::endl;
+                MotionControlResult result;
+                result.errorCode = ErrorCode_MotionControl::FAILURE;
+                return result;
+            }
+
+            // 使用Configure命令切换身体高度
+            return request2_Configure(ConfigCommand::SWITCH_BODY_HEIGHT, height);
+        } catch (const std::exception& e) {
+            std::cerr << "request2_SwitchBodyHeight 异常: " << e.what() << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        } catch (...) {
+            std::cerr << "request2_SwitchBodyHeight 未知异常" << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        }
+    }
+
+    MotionControlResult request2_SwitchGait(GaitMode mode) {
+        try {
+            // 使用Configure命令设置步态模式
+            return request2_Configure(ConfigCommand::GAIT_SWITCH, static_cast<int>(mode));
+        } catch (const std::exception& e) {
+            std::cerr << "request2_SwitchGait 异常: " << e.what() << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        } catch (...) {
+            std::cerr << "request2_SwitchGait 未知异常" << std::endl;
+            MotionControlResult result;
+            result.errorCode = ErrorCode_MotionControl::UNKNOWN_ERROR;
+            return result;
+        }
+    }
+
+private:
+
+    // 等待响应的结果
+    enum class AwaitResult {
+        RESPONDED,        // 收到响应
+        TIMEOUT,          // 截止时间前未收到响应
+        CONNECTION_LOST,  // 等待期间连接丢失
+        DROPPED           // 请求在发送队列中被丢弃或被取代，未发出
+    };
+
+    // 发出请求：生成序列号、登记待处理请求并发送
+    template <typename Request>
+    RequestTicket submitRequest(Request& request, protocol::MessageType expectedType) {
+        RequestTicket ticket;
+        if (!isConnected()) {
+            return ticket;
+        }
+
+        // 生成并设置序列号
+        ticket.seqNum = generateSequenceNumber();
+        request.setSequenceNumber(ticket.seqNum);
+
+        // 重连后需要重发的请求保留一份副本；运动控制命令重连后已过时，从不重发
+        std::shared_ptr<protocol::IMessage> replayRequest;
+        if (options_.reconnect.pendingRequestPolicy == PendingRequestPolicy::REPLAY &&
+            expectedType != protocol::MessageType::MOTION_CONTROL_RESP) {
+            replayRequest = std::make_shared<Request>(request);
+        }
+
+        // 添加到待处理请求，并获取future
+        ticket.future = addPendingRequest(ticket.seqNum, expectedType, channelFor(request.getType()),
+                                          std::move(replayRequest));
+
+        // 发送请求
+        ticket.sent = network_model_->sendMessage(request);
+        if (!ticket.sent) {
+            removePendingRequest(ticket.seqNum);
+        }
+
+        return ticket;
+    }
+
+    // 等待响应直到截止时间，无论结果如何都移除待处理请求
+    template <typename ResponseType>
+    std::unique_ptr<ResponseType> awaitResponse(RequestTicket& ticket, std::chrono::steady_clock::time_point deadline, AwaitResult& result) {
+        // 创建ScopeGuard，在函数结束时自动移除请求
+        auto guard = makeScopeGuard([this, &ticket]() {
+            removePendingRequest(ticket.seqNum);
+        });
+
+        // 等待响应，使用future替代条件变量；调用方驱动时等待期间在本线程中执行IO处理函数
+        if (runtime_->impl_->io_pool->waitUntil(ticket.future, deadline) != std::future_status::ready) {
+            result = AwaitResult::TIMEOUT;
+            return nullptr;
+        }
+
+        // 连接丢失或请求被发送队列丢弃时promise被置为false
+        if (!ticket.future.get()) {
+            result = requestDropped(ticket.seqNum) ? AwaitResult::DROPPED : AwaitResult::CONNECTION_LOST;
+            return nullptr;
+        }
+
+        result = AwaitResult::RESPONDED;
+        return getResponse<ResponseType>(ticket.seqNum);
+    }
+
+    // 通过回调派发器调用用户回调（IO线程中直接调用或放入回调队列），回调中的异常被捕获并记录
+    template <typename Callback, typename... Args>
+    void dispatchCallback(Callback callback, const char* callbackType, Args... args) {
+        if (!callback) {
+            return;
+        }
+        callbacks_.dispatch([callback = std::move(callback), callbackType, args...]() {
+            safeCallback(callback, callbackType, args...);
+        });
+    }
+
+    // 连接丢失：结束未完成的请求和导航任务回调，keepReplayable 为 true 时保留可重发的请求
+    void failPendingRequests(bool keepReplayable) {
+        {
+            std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+            for (auto& entry : pendingRequests_) {
+                PendingRequest& req = entry.second;
+                if (req.responseReceived || (keepReplayable && req.replayRequest)) {
+                    continue;
+                }
+                try {
+                    req.promise->set_value(false);
+                } catch (const std::future_error&) {
+                    // 忽略已经设置过值的promise
+                }
+            }
+        }
+
+        // 导航任务的结果只会在原连接上返回，连接丢失后无法再等到
+        std::map<uint16_t, NavigationResultCallback> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(navigation_result_callbacks_mutex_);
+            callbacks.swap(navigation_result_callbacks_);
+        }
+        for (auto& entry : callbacks) {
+            NavigationResult failResult;
+            failResult.errorCode = ErrorCode_Navigation::NOT_CONNECTED;
+            dispatchCallback(std::move(entry.second), "导航结果", failResult);
+        }
+    }
+
+    // 重连成功：按原序列号重发仍在等待响应的请求
+    void replayPendingRequests() {
+        std::vector<std::shared_ptr<protocol::IMessage>> requests;
+        {
+            std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+            auto now = std::chrono::steady_clock::now();
+            for (auto& entry : pendingRequests_) {
+                if (entry.second.replayRequest && !entry.second.responseReceived) {
+                    entry.second.sentAt = now;
+                    requests.push_back(entry.second.replayRequest);
+                }
+            }
+        }
+
+        for (const auto& request : requests) {
+            network_model_->sendMessage(*request);
+        }
+    }
+
+    bool requestDropped(uint16_t sequenceNumber) {
+        std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+        auto it = pendingRequests_.find(sequenceNumber);
+        return it != pendingRequests_.end() && it->second.dropped;
+    }
+
+    void removePendingRequest(uint16_t sequenceNumber) {
+        std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+        pendingRequests_.erase(sequenceNumber);
+    }
+
+    std::future<bool> addPendingRequest(uint16_t sequenceNumber, protocol::MessageType expectedType,
+                                        ConnectionChannel channel,
+                                        std::shared_ptr<protocol::IMessage> replayRequest = nullptr) {
+        PendingRequest req;
+        req.expectedResponseType = expectedType;
+        req.channel = channel;
+        req.sentAt = std::chrono::steady_clock::now();
+        req.replayRequest = std::move(replayRequest);
+        req.responseReceived = false;
+        req.promise = std::make_shared<std::promise<bool>>();
+
+        // 在插入前获取future
+        std::future<bool> future = req.promise->get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+            pendingRequests_[sequenceNumber] = std::move(req);
+        }
+
+        return future;
+    }
+
+    // 获取并清除响应
+    template<typename ResponseType>
+    std::unique_ptr<ResponseType> getResponse(uint16_t sequenceNumber) {
+        std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+        auto it = pendingRequests_.find(sequenceNumber);
+        if (it == pendingRequests_.end() || !it->second.responseReceived) {
+            return nullptr;
+        }
+
+        // 直接在 unique_ptr 的构造时进行 dynamic_cast
+        std::unique_ptr<ResponseType> result(dynamic_cast<ResponseType*>(it->second.response.release()));
+
+        return result;
+    }
+
+    // 请求使用的连接通道，单连接时统一记为 CONTROL
+    ConnectionChannel channelFor(protocol::MessageType requestType) const {
+        return dual_model_ ? network::DualConnectionNetworkModel::channelFor(requestType) : ConnectionChannel::CONTROL;
+    }
+
+    SdkOptions options_;
+    std::shared_ptr<SdkRuntime> runtime_;
+    CallbackDispatcher callbacks_;
+    std::shared_ptr<network::ReconnectingNetworkModel> network_model_;
+    // 启用独立控制连接时为 network_model_ 包装的双连接，必须在 network_model_ 之前析构
+    std::shared_ptr<network::DualConnectionNetworkModel> dual_model_;
+
+    // 生成序列号， 从0到65535后溢出回到0
+    uint16_t generateSequenceNumber() {
+        static std::atomic<uint16_t> sequenceNumber = 0;
+        return ++sequenceNumber;
+    }
+
+    struct PendingRequest {
+        protocol::MessageType expectedResponseType{};
+        std::unique_ptr<protocol::IMessage> response{};
+        bool responseReceived{false};
+        std::shared_ptr<std::promise<bool>> promise = std::make_shared<std::promise<bool>>();
+        std::shared_ptr<protocol::IMessage> replayRequest{}; // 重连后重发的请求副本，为空表示不重发
+        bool dropped{false}; // 在发送队列中被丢弃或被取代
+        ConnectionChannel channel{ConnectionChannel::CONTROL}; // 发送请求的连接通道
+        std::chrono::steady_clock::time_point sentAt{}; // 发出（或重连后重发）的时间，用于统计往返时延
+    };
+
+    /**
+     * @brief 往返时延统计，平滑值与TCP的SRTT相同，每个新样本占1/8权重
+     */
+    struct RttEstimator {
+        uint64_t samples = 0;
+        uint64_t last = 0;
+        uint64_t smoothed = 0;
+        uint64_t min = 0;
+        uint64_t max = 0;
+
+        void add(uint64_t micros) {
+            smoothed = samples == 0 ? micros : (smoothed * 7 + micros) / 8;
+            min = samples == 0 ? micros : std::min(min, micros);
+            max = std::max(max, micros);
+            last = micros;
+            ++samples;
+        }
+
+        void fill(ConnectionStatistics& stats) const {
+            stats.rttSamples = samples;
+            stats.rttLastMicros = last;
+            stats.rttSmoothedMicros = smoothed;
+            stats.rttMinMicros = min;
+            stats.rttMaxMicros = max;
+        }
+    };
+
+    // 往返时延统计的下标：0为全部请求，1、2为控制连接和数据连接
+    static std::size_t rttIndex(ConnectionChannel channel) {
+        return channel == ConnectionChannel::CONTROL ? 1 : 2;
+    }
+
+    // 收到响应时记录往返时延（调用方持有 pending_requests_mutex_）
+    void recordRtt(const PendingRequest& req) {
+        auto rtt = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - req.sentAt);
+        uint64_t micros = static_cast<uint64_t>(std::max<int64_t>(rtt.count(), 0));
+        std::lock_guard<std::mutex> lock(rtt_mutex_);
+        rtt_[0].add(micros);
+        rtt_[rttIndex(req.channel)].add(micros);
+    }
+
+    mutable std::mutex rtt_mutex_;
+    RttEstimator rtt_[3];
+
+    // 使用标准的std::map和互斥锁
+    std::mutex pending_requests_mutex_;
+    std::map<uint16_t, PendingRequest> pendingRequests_;
+
+    std::mutex navigation_result_callbacks_mutex_;
+    std::map<uint16_t, NavigationResultCallback> navigation_result_callbacks_;
+
+    // 最近一次通知的连接状态及用户的状态回调
+    std::atomic<ConnectionState> connection_state_{ConnectionState::DISCONNECTED};
+    std::mutex connection_state_callback_mutex_;
+    ConnectionStateCallback connection_state_callback_;
+
+    // 速度命令的上次发送时间（用于频率控制）
+    std::chrono::steady_clock::time_point lastSpeedCommandTime_ = std::chrono::steady_clock::now();
+};
+
+} // namespace robotserver_sdk
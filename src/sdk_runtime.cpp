@@ -0,0 +1,144 @@
+#include <sdk_runtime.h>
+
+#include "sdk_runtime_impl.hpp"
+#include "network/asio_network_model.hpp"
+#include "network/epoll_network_model.hpp"
+#include "network/io_uring_network_model.hpp"
+#include "network/shm_network_model.hpp"
+#include <iostream>
+
+namespace robotserver_sdk {
+
+SdkRuntime::SdkRuntime(std::size_t ioThreadCount)
+    : SdkRuntime(ioThreadCount, BusyPollOptions()) {
+}
+
+SdkRuntime::SdkRuntime(std::size_t ioThreadCount, const BusyPollOptions& busyPoll, const ThreadOptions& threads)
+    : impl_(std::make_unique<SdkRuntimeImpl>(ioThreadCount, busyPoll, threads)) {
+}
+
+SdkRuntime::~SdkRuntime() = default;
+
+std::size_t SdkRuntime::ioThreadCount() const {
+    return impl_->io_pool->threadCount();
+}
+
+std::vector<ThreadStatus> SdkRuntime::threadStatus() const {
+    return impl_->threads->status();
+}
+
+int SdkRuntime::completionEventFd() {
+    auto queue = impl_->completionQueue();
+    return queue ? queue->fd() : -1;
+}
+
+std::size_t SdkRuntime::drainCompletions() {
+    auto queue = impl_->completionQueue();
+    return queue ? queue->drain() : 0;
+}
+
+std::size_t SdkRuntime::poll(std::chrono::milliseconds timeout) {
+    return impl_->io_pool->callerDriven() ? impl_->io_pool->poll(timeout) : 0;
+}
+
+std::shared_ptr<network::BaseNetworkModel> SdkRuntimeImpl::createTransport(network::INetworkCallback& callback,
+                                                                           const SdkOptions& options) {
+    switch (options.transport) {
+    case TransportBackend::SHARED_MEMORY: {
+        auto transport = std::make_shared<network::ShmNetworkModel>(callback, io_pool);
+        transport->setConnectionTimeout(options.connectionTimeout);
+        transport->setThreadConfigurator(threads);
+        return transport;
+    }
+    case TransportBackend::IO_URING:
+        if (auto reactor = ioUringReactor()) {
+            auto transport = std::make_shared<network::IoUringNetworkModel>(callback, reactor, hostResolver());
+            transport->setConnectionTimeout(options.connectionTimeout);
+            transport->setSocketOptions(options.socket);
+            transport->setSendQueueOptions(options.sendQueue);
+            return transport;
+        }
+        // 内核不支持io_uring时回退到epoll
+        [[fallthrough]];
+    case TransportBackend::EPOLL: {
+        auto transport = std::make_shared<network::EpollNetworkModel>(callback, epollReactor(), hostResolver());
+        transport->setConnectionTimeout(options.connectionTimeout);
+        transport->setSocketOptions(options.socket);
+        transport->setSendQueueOptions(options.sendQueue);
+        return transport;
+    }
+    case TransportBackend::ASIO:
+    default: {
+        auto transport = std::make_shared<network::AsioNetworkModel>(callback, io_pool);
+        transport->setConnectionTimeout(options.connectionTimeout);
+        transport->setSocketOptions(options.socket);
+        transport->setSendQueueOptions(options.sendQueue);
+        return transport;
+    }
+    }
+}
+
+std::shared_ptr<network::EpollReactor> SdkRuntimeImpl::epollReactor() {
+    std::lock_guard<std::mutex> lock(epoll_reactor_mutex_);
+    if (!epoll_reactor_) {
+        epoll_reactor_ = std::make_shared<network::EpollReactor>(spin_, threads);
+    }
+    return epoll_reactor_;
+}
+
+std::shared_ptr<network::IoUringReactor> SdkRuntimeImpl::ioUringReactor() {
+    std::lock_guard<std::mutex> lock(io_uring_reactor_mutex_);
+    if (!io_uring_reactor_ && !io_uring_unsupported_) {
+        try {
+            io_uring_reactor_ = std::make_shared<network::IoUringReactor>(spin_, threads);
+        } catch (const std::exception& e) {
+            std::cerr << "io_uring不可用，回退到epoll: " << e.what() << std::endl;
+            io_uring_unsupported_ = true;
+        }
+    }
+    return io_uring_reactor_;
+}
+
+bool SdkRuntimeImpl::runningInThisThread() {
+    if (io_pool->runningInThisThread()) {
+        return true;
+    }
+    {
+        std::lock_guard<std::mutex> lock(epoll_reactor_mutex_);
+        if (epoll_reactor_ && epoll_reactor_->runningInThisThread()) {
+            return true;
+        }
+    }
+    std::lock_guard<std::mutex> lock(io_uring_reactor_mutex_);
+    return io_uring_reactor_ && io_uring_reactor_->runningInThisThread();
+}
+
+std::shared_ptr<CallbackThread> SdkRuntimeImpl::callbackThread() {
+    std::lock_guard<std::mutex> lock(callback_thread_mutex_);
+    if (!callback_thread_) {
+        callback_thread_ = std::make_shared<CallbackThread>(threads);
+    }
+    return callback_thread_;
+}
+
+std::shared_ptr<CompletionQueue> SdkRuntimeImpl::completionQueue() {
+    std::lock_guard<std::mutex> lock(completion_queue_mutex_);
+    if (!completion_queue_) {
+        try {
+            completion_queue_ = std::make_shared<CompletionQueue>();
+        } catch (const std::exception& e) {
+            std::cerr << "创建完成队列失败，回调将在IO线程中直接调用: " << e.what() << std::endl;
+        }
+    }
+    return completion_queue_;
+}
+
+std::shared_ptr<network::HostResolver> SdkRuntimeImpl::hostResolver() {
+    std::lock_guard<std::mutex> lock(host_resolver_mutex_);
+    if (!host_resolver_) {
+        host_resolver_ = std::make_shared<network::HostResolver>(threads);
+    }
+    return host_resolver_;
+}
+
+} // namespace robotserver_sdk
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <sdk_runtime.h>
+#include <memory>
+#include <mutex>
+
+#include "types.h"
+#include "callback_executor.hpp"
+#include "network/base_network_model.hpp"
+#include "network/epoll_reactor.hpp"
+#include "network/host_resolver.hpp"
+#include "network/io_uring_reactor.hpp"
+#include "network/io_context_pool.hpp"
+
+namespace robotserver_sdk {
+
+/**
+ * @brief SDK运行时实现
+ */
+class SdkRuntimeImpl {
+public:
+    SdkRuntimeImpl(std::size_t ioThreadCount, const BusyPollOptions& busyPoll, const ThreadOptions& threadOptions)
+        : threads(std::make_shared<network::ThreadConfigurator>(threadOptions)),
+          io_pool(std::make_shared<network::IoContextPool>(ioThreadCount, spinDuration(busyPoll), threads)),
+          spin_(spinDuration(busyPoll)) {
+    }
+
+    /**
+     * @brief 按配置创建传输层
+     * @param callback 传输层回调接口
+     * @param options SDK配置选项
+     * @return 传输层实现
+     */
+    std::shared_ptr<network::BaseNetworkModel> createTransport(network::INetworkCallback& callback,
+                                                               const SdkOptions& options);
+
+    /**
+     * @brief 获取共享的epoll事件循环，第一次使用时创建
+     */
+    std::shared_ptr<network::EpollReactor> epollReactor();
+
+    /**
+     * @brief 获取共享的io_uring事件循环，第一次使用时创建
+     * @return 事件循环，内核不支持io_uring时返回空
+     */
+    std::shared_ptr<network::IoUringReactor> ioUringReactor();
+
+    /**
+     * @brief 当前线程是否为IO线程或已创建的epoll/io_uring事件循环线程
+     */
+    bool runningInThisThread();
+
+    /**
+     * @brief 获取共享的专用回调线程，第一次使用时创建
+     */
+    std::shared_ptr<CallbackThread> callbackThread();
+
+    /**
+     * @brief 获取共享的完成队列，第一次使用时创建
+     * @return 完成队列，创建eventfd失败时返回空
+     */
+    std::shared_ptr<CompletionQueue> completionQueue();
+
+    /**
+     * @brief 获取共享的主机名解析线程，第一次使用时创建
+     */
+    std::shared_ptr<network::HostResolver> hostResolver();
+
+    std::shared_ptr<network::ThreadConfigurator> threads; ///< 运行时创建的所有线程的配置和设置结果
+    std::shared_ptr<network::IoContextPool> io_pool; ///< 共享的IO线程池
+
+private:
+    static std::chrono::microseconds spinDuration(const BusyPollOptions& busyPoll) {
+        return busyPoll.enabled ? busyPoll.spinDuration : std::chrono::microseconds(0);
+    }
+
+    std::chrono::microseconds spin_; ///< 事件循环线程的忙轮询自旋时长，0为不忙轮询
+    std::mutex epoll_reactor_mutex_;
+    std::shared_ptr<network::EpollReactor> epoll_reactor_; ///< 共享的epoll事件循环
+    std::mutex io_uring_reactor_mutex_;
+    std::shared_ptr<network::IoUringReactor> io_uring_reactor_; ///< 共享的io_uring事件循环
+    bool io_uring_unsupported_ = false; ///< 创建io_uring事件循环失败后不再重试
+    std::mutex callback_thread_mutex_;
+    std::shared_ptr<CallbackThread> callback_thread_; ///< 共享的专用回调线程
+    std::mutex completion_queue_mutex_;
+    std::shared_ptr<CompletionQueue> completion_queue_; ///< 共享的完成队列（EVENT_FD 回调方式）
+    std::mutex host_resolver_mutex_;
+    std::shared_ptr<network::HostResolver> host_resolver_; ///< 共享的主机名解析线程（EPOLL/IO_URING 传输）
+};
+
+} // namespace robotserver_sdk
@@ -0,0 +1,140 @@
+/**
+ * @file outbound_queue_test.cpp
+ * @brief 发送队列软急停优先级回归测试
+ *
+ * 不经过网络，直接驱动 OutboundQueue 的批次接口，结果是确定的：
+ * 写出一个批次期间入队软急停，批次完成后下一个批次的第一帧必须是软急停，
+ * 包括排在它前面的普通帧超过 64 KiB（单次写操作的聚合上限）的情况。
+ */
+
+#include "network/outbound_queue.hpp"
+#include "protocol/messages.hpp"
+#include "protocol/serializer.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t LARGE_FRAME_BYTES = 64 * 1024;
+
+uint16_t g_sequence = 1;
+
+// 与网络层相同：从缓冲区池取消息体，序列化后入队，返回帧的序列号
+uint16_t pushMessage(network::OutboundQueue& queue, protocol::IMessage& message) {
+    uint16_t sequence = g_sequence++;
+    message.setSequenceNumber(sequence);
+
+    protocol::Serializer serializer;
+    protocol::SerializedFrame frame;
+    frame.body = queue.acquireBody();
+    serializer.serializeFrame(message, frame);
+    queue.push(std::move(frame));
+    return sequence;
+}
+
+uint16_t pushStatus(network::OutboundQueue& queue) {
+    protocol::GetRealTimeStatusRequest status;
+    return pushMessage(queue, status);
+}
+
+uint16_t pushEmergencyStop(network::OutboundQueue& queue) {
+    protocol::MotionControlRequest motion;
+    motion.command = static_cast<int>(robotserver_sdk::ActionCommand::SOFT_EMERGENCY_STOP);
+    return pushMessage(queue, motion);
+}
+
+// 导航点足够多，使消息体超过单次写操作的聚合上限
+uint16_t pushLargeNavigation(network::OutboundQueue& queue) {
+    protocol::NavigationTaskRequest navigation;
+    std::string body;
+    for (int i = 0; body.size() <= LARGE_FRAME_BYTES; ++i) {
+        protocol::NavigationPoint point;
+        point.mapId = 1;
+        point.value = i;
+        point.posX = 12.345678 + i * 0.25;
+        point.posY = -3.5 + i * 0.125;
+        point.gait = 0x3002;
+        point.speed = 1;
+        navigation.points.push_back(point);
+        if (i % 100 == 0) {
+            body.clear();
+            navigation.serializeTo(body);
+        }
+    }
+    return pushMessage(queue, navigation);
+}
+
+// 开始下一个批次，检查第一帧的序列号
+bool expectFirst(network::OutboundQueue& queue, uint16_t expected, const char* name) {
+    const std::vector<protocol::SerializedFrame>& batch = queue.beginBatch();
+    if (batch.empty() || batch.front().header.sequenceNumber != expected) {
+        std::fprintf(stderr, "%s: 批次第一帧应为 %u，实际为 %d\n", name, static_cast<unsigned>(expected),
+                     batch.empty() ? -1 : static_cast<int>(batch.front().header.sequenceNumber));
+        return false;
+    }
+    return true;
+}
+
+void finishBatch(network::OutboundQueue& queue) {
+    queue.completeBatch(queue.batchBytes());
+}
+
+// 写出普通帧期间入队软急停，后面还排着普通帧
+bool checkEmergencyStopAfterNormalBatch() {
+    network::OutboundQueue queue;
+    pushStatus(queue);
+    pushStatus(queue);
+    queue.beginBatch();
+
+    pushStatus(queue);
+    pushStatus(queue);
+    uint16_t estop = pushEmergencyStop(queue);
+
+    finishBatch(queue);
+    return expectFirst(queue, estop, "普通帧之后");
+}
+
+// 软急停之前排着超过 64 KiB 的帧：软急停单独先写出，大帧在下一个批次
+bool checkEmergencyStopBeforeQueuedLargeFrame() {
+    network::OutboundQueue queue;
+    pushStatus(queue);
+    queue.beginBatch();
+
+    uint16_t large = pushLargeNavigation(queue);
+    uint16_t estop = pushEmergencyStop(queue);
+
+    finishBatch(queue);
+    if (!expectFirst(queue, estop, "排队的大帧之前")) {
+        return false;
+    }
+    finishBatch(queue);
+    return expectFirst(queue, large, "软急停之后的大帧");
+}
+
+// 正在写出的批次是超过 64 KiB 的帧：完成后软急停排在其余普通帧之前
+bool checkEmergencyStopAfterLargeBatch() {
+    network::OutboundQueue queue;
+    pushLargeNavigation(queue);
+    if (queue.beginBatch().size() != 1 || queue.batchBytes() <= LARGE_FRAME_BYTES) {
+        std::fprintf(stderr, "大帧应单独作为一个批次写出\n");
+        return false;
+    }
+
+    pushStatus(queue);
+    uint16_t estop = pushEmergencyStop(queue);
+
+    finishBatch(queue);
+    return expectFirst(queue, estop, "写出大帧之后");
+}
+
+}  // namespace
+
+int main() {
+    bool ok = checkEmergencyStopAfterNormalBatch();
+    ok = checkEmergencyStopBeforeQueuedLargeFrame() && ok;
+    ok = checkEmergencyStopAfterLargeBatch() && ok;
+    std::printf("软急停优先级: %s\n", ok ? "通过" : "失败");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file request_alloc_test.cpp
+ * @brief 请求路径的堆分配次数回归测试
+ *
+ * 替换全局 operator new 统计本进程（调用线程和SDK的IO线程）的堆分配次数，模拟服务端运行在子进程中不计入：
+ * 1. 请求的时间戳和序列化：预热后写入复用缓冲区不分配内存；
+ * 2. 通过 RobotServerSdk 对回环地址上的模拟服务端发送 1002 请求：预热后每个请求的分配次数不超过上限。
+ * 只统计次数不计时，结果不受机器负载影响。
+ */
+
+#include <robotserver_sdk.h>
+#include "mock_robot_server.hpp"
+#include "protocol/messages.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace {
+
+std::atomic<uint64_t> g_allocations{0};
+
+void* countedAlloc(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+// 预热后每个 1002 请求允许的分配次数：promise/future 的共享状态、待处理请求表的节点、
+// 接收路径的消息体和响应对象等；超过说明请求路径引入了新的分配
+constexpr double MAX_ALLOCATIONS_PER_REQUEST = 16.0;
+
+constexpr int WARMUP_REQUESTS = 200;
+constexpr int MEASURED_REQUESTS = 1000;
+
+}  // namespace
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// 时间戳和序列化写入复用缓冲区，预热后不应分配内存
+bool checkSerializeAllocationFree() {
+    std::string out;
+    out.reserve(4096);
+    protocol::GetRealTimeStatusRequest status;
+    protocol::MotionControlRequest motion;
+    motion.command = 11;
+    motion.setValue(0.35f);
+
+    uint64_t before = g_allocations.load();
+    for (int i = 0; i < MEASURED_REQUESTS; ++i) {
+        out.clear();
+        status.serializeTo(out);
+        motion.serializeTo(out);
+    }
+    uint64_t allocations = g_allocations.load() - before;
+
+    if (out.find("<Time>") == std::string::npos || protocol::currentTimestamp().size() != 19) {
+        std::fprintf(stderr, "序列化结果中缺少时间戳\n");
+        return false;
+    }
+    if (allocations != 0) {
+        std::fprintf(stderr, "序列化 %d 次请求发生 %llu 次堆分配\n", 2 * MEASURED_REQUESTS,
+                     static_cast<unsigned long long>(allocations));
+        return false;
+    }
+    return true;
+}
+
+// 通过 RobotServerSdk 对回环模拟服务端发送请求，统计预热后每个请求的分配次数
+bool checkRequestAllocations(uint16_t port) {
+    robotserver_sdk::RobotServerSdk sdk;
+    if (!sdk.connect("127.0.0.1", port)) {
+        std::fprintf(stderr, "连接模拟服务端失败\n");
+        return false;
+    }
+
+    for (int i = 0; i < WARMUP_REQUESTS; ++i) {
+        sdk.request1002_RunTimeState();
+    }
+
+    uint64_t before = g_allocations.load();
+    for (int i = 0; i < MEASURED_REQUESTS; ++i) {
+        robotserver_sdk::RealTimeStatus status = sdk.request1002_RunTimeState();
+        if (status.errorCode != robotserver_sdk::ErrorCode_RealTimeStatus::SUCCESS) {
+            std::fprintf(stderr, "1002 请求失败: %d\n", static_cast<int>(status.errorCode));
+            return false;
+        }
+    }
+    double perRequest = static_cast<double>(g_allocations.load() - before) / MEASURED_REQUESTS;
+    sdk.disconnect();
+
+    std::printf("1002 请求: 每个请求 %.2f 次堆分配（上限 %.0f）\n", perRequest, MAX_ALLOCATIONS_PER_REQUEST);
+    if (perRequest > MAX_ALLOCATIONS_PER_REQUEST) {
+        std::fprintf(stderr, "请求路径的堆分配次数超过上限\n");
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main() {
+    if (!checkSerializeAllocationFree()) {
+        return 1;
+    }
+
+    pid_t child = 0;
+    uint16_t port = benchmark::startMockServerProcess(child);
+    if (port == 0) {
+        std::fprintf(stderr, "启动模拟服务端失败\n");
+        return 1;
+    }
+
+    bool ok = checkRequestAllocations(port);
+    benchmark::stopMockServerProcess(child);
+    return ok ? 0 : 1;
+}